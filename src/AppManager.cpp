@@ -4,6 +4,7 @@
 #include "PowerManager.h"
 #include "GlobalUI.h"
 #include "LvZhFont.h"
+#include "Performance.h"
 #include <lvgl.h>
 #include <Arduino.h>
 #include <cstring>
@@ -57,6 +58,8 @@ void BaseApp::onDestroy() {
         return;
     }
     
+    Perf.cancelUi(this);
+    
     saveState();
     destroyUI();
     
@@ -125,6 +128,8 @@ AppManager::AppManager() {
     _appContainer = nullptr;
     _switching = false;
     _switchStartTime = 0;
+    _preloadJob = 0;
+    _preloadApp[0] = '\0';
     
     memset(_apps, 0, sizeof(_apps));
 }
@@ -158,7 +163,10 @@ bool AppManager::begin() {
     return true;
 }
 
+// Runs on the app task (core 0); onUpdate() may touch LVGL objects
 void AppManager::update() {
+    LvglLock lock;
+    
     if (_switching && millis() - _switchStartTime > 100) {
         _switching = false;
     }
@@ -213,6 +221,9 @@ bool AppManager::switchToApp(const char* name) {
                 return false;
             }
             
+            // Usually already running from the home screen press
+            preloadAppResources(name);
+            
             _switching = true;
             _switchStartTime = millis();
             
@@ -273,6 +284,7 @@ bool AppManager::switchToHome() {
     }
     
     cleanupPausedApp();
+    cancelPreload();
     
     Power.resetIdleTimer();
     Serial.println("[AppMgr] Returned to home screen");
@@ -291,11 +303,33 @@ void AppManager::cleanupPausedApp() {
     }
 }
 
-bool AppManager::preloadAppResources(const char* appName) {
+uint32_t AppManager::preloadAppResources(const char* appName) {
+    if (_preloadJob && strcmp(_preloadApp, appName) == 0) {
+        preload_state_t state = Storage.getPreloadState(_preloadJob);
+        if (state == PRELOAD_QUEUED || state == PRELOAD_RUNNING) {
+            return _preloadJob;
+        }
+    }
+    
+    cancelPreload();
+    
     char manifestPath[64];
     snprintf(manifestPath, sizeof(manifestPath), "F:/%s_manifest.json", appName);
     
-    return Storage.preloadResources(manifestPath);
+    _preloadJob = Storage.preloadAsync(manifestPath, APP_PRELOAD_PRIORITY);
+    if (_preloadJob) {
+        strncpy(_preloadApp, appName, APP_NAME_MAX_LEN - 1);
+        _preloadApp[APP_NAME_MAX_LEN - 1] = '\0';
+    }
+    return _preloadJob;
+}
+
+void AppManager::cancelPreload() {
+    if (_preloadJob) {
+        Storage.cancelPreload(_preloadJob);
+    }
+    _preloadJob = 0;
+    _preloadApp[0] = '\0';
 }
 
 app_info_t AppManager::getAppInfo(int index) const {
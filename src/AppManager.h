@@ -8,6 +8,7 @@
 #define APP_MAX_APPS            8
 #define APP_NAME_MAX_LEN        24
 #define APP_STATE_FILE          "/app_state.json"
+#define APP_PRELOAD_PRIORITY    8       // above background manifest jobs
 
 typedef enum {
     APP_STATE_STOPPED = 0,
@@ -85,8 +86,10 @@ private:
     bool _switching;
     uint32_t _switchStartTime;
     
+    uint32_t _preloadJob;
+    char _preloadApp[APP_NAME_MAX_LEN];
+    
     void cleanupPausedApp();
-    bool preloadAppResources(const char* appName);
     
 public:
     AppManager();
@@ -101,6 +104,12 @@ public:
     bool switchToHome();
     bool closeCurrentApp();
     
+    // Warms the cache from F:/<app>_manifest.json on the preloader task;
+    // the F:/S: drivers then serve those files from RAM. Starting another
+    // app's preload or going home cancels it.
+    uint32_t preloadAppResources(const char* appName);
+    void cancelPreload();
+    
     BaseApp* getActiveApp() const { return _activeApp; }
     BaseApp* getPausedApp() const { return _pausedApp; }
     
@@ -3,13 +3,15 @@
 #include "Storage.h"
 #include "PowerManager.h"
 #include "Performance.h"
+#include "DisplayFlush.h"
 #include <TFT_eSPI.h>
-#include <XPT2046_Touchscreen.h>
 #include <SPIFFS.h>
+#include <esp_heap_caps.h>
+
+static_assert(FLUSH_MAX_AREAS >= LV_INV_BUF_SIZE, "FLUSH_MAX_AREAS smaller than LV_INV_BUF_SIZE in lv_conf.h");
 
 static TFT_eSPI tft = TFT_eSPI();
 static SPIClass touchSPI;
-XPT2046_Touchscreen* touchscreen = nullptr;
 static SPIClass sdSPI(VSPI);
 
 static bool displayReady = false;
@@ -18,16 +20,78 @@ static bool sdReady = false;
 static bool spiffsReady = false;
 static uint8_t currentBacklight = 255;
 
-#define VDB_BUFFER_SIZE (BSP_DISPLAY_WIDTH * 10)
-static lv_color_t buf1[VDB_BUFFER_SIZE];
+static lv_color_t* buf1 = nullptr;
 static lv_color_t* buf2 = nullptr;
+static uint32_t vdbPixels = 0;
+static bool dmaEnabled = false;
+static uint16_t flushWindows = 0;
+
+static bool tftDmaBusy() { return tft.dmaBusy(); }
+static void tftDmaWait() { tft.dmaWait(); }
+static void tftEndWrite() { tft.endWrite(); }
+
+static const flush_bus_t tftBus = { tftDmaBusy, tftDmaWait, tftEndWrite };
+static FlushTracker flushDma(&tftBus);
+
+// CASET and RASET with four parameter bytes each, then RAMWR
+#define FLUSH_WINDOW_BYTES  11
+
+// Invalid areas LVGL left separate are merged further when the union
+// redraws at most this many percent more pixels than are dirty. Fewer,
+// larger areas mean fewer stripes, windows and render passes.
+static uint8_t overdrawBudgetPct = 25;
+
+static flush_row_t panelRows[BSP_DISPLAY_HEIGHT];
+static FlushFilter flushFilter(panelRows, BSP_DISPLAY_HEIGHT);
 static lv_disp_draw_buf_t draw_buf;
 static lv_disp_drv_t disp_drv;
 static lv_indev_drv_t indev_drv;
 
 static int16_t lastX = 0;
 static int16_t lastY = 0;
-static bool touchFpsOptimizeEnabled = false;
+static bool lastPressed = false;
+
+// XPT2046 is sampled by its own task on core 0, so the LVGL task never
+// waits on the touch SPI bus. PENIRQ wakes the sampling task; while the
+// pen is down it converts every TOUCH_SAMPLE_MS and queues filtered,
+// calibrated points for bsp_touch_read(). Between presses the LVGL read
+// timer is paused, but only after any scroll throw has settled.
+#define TOUCH_TASK_STACK     2048
+#define TOUCH_TASK_PRIORITY  4
+#define TOUCH_SAMPLE_MS      LV_INDEV_DEF_READ_PERIOD
+#define TOUCH_POLL_MS        50     // idle polling when there is no PENIRQ
+#define TOUCH_OVERSAMPLE     5      // conversions per axis, median taken
+#define TOUCH_MAX_SPREAD     48     // raw counts across the middle three
+#define TOUCH_Z_THRESHOLD    400
+#define TOUCH_RING_LEN       32     // power of two
+#define TOUCH_IDLE_READS     3
+
+#define XPT_CMD_X   0x91    // 12-bit differential, PENIRQ off during conversion
+#define XPT_CMD_Y   0xD1
+#define XPT_CMD_Z1  0xB1
+#define XPT_CMD_Z2  0xC1
+#define XPT_CMD_PD  0xD0    // Y, then power down with PENIRQ enabled
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    bool pressed;
+    uint32_t us;            // PENIRQ time for the first point of a press
+} touch_sample_t;
+
+// Single producer (touch task), single consumer (LVGL task)
+static touch_sample_t touchRing[TOUCH_RING_LEN];
+static volatile uint32_t touchHead = 0;
+static volatile uint32_t touchTail = 0;
+static uint32_t touchDropped = 0;
+
+static TaskHandle_t touchTaskHandle = nullptr;
+static int8_t touchCsPin = -1;
+static int8_t touchIrqPin = -1;
+static volatile uint32_t touchIrqUs = 0;
+static bsp_touch_cal_matrix_t touchCal;
+static bool touchPaused = false;
+static uint8_t touchIdleReads = 0;
 
 static void initPWM() {
     Serial.println("[BSP] Initializing PWM backlight on GPIO 21...");
@@ -39,60 +103,284 @@ static void initPWM() {
     Serial.printf("  Channel: 0, Pin: %d\n", BSP_BACKLIGHT_PIN);
 }
 
+static void pushRun(int16_t x, int16_t y, uint32_t w, uint32_t h, uint16_t* px) {
+    flushWindows++;
+    if (dmaEnabled) {
+        // A previous run of this flush may still be on the bus
+        tft.dmaWait();
+        tft.setAddrWindow(x, y, w, h);
+        tft.pushPixelsDMA(px, w * h);
+    } else {
+        tft.setAddrWindow(x, y, w, h);
+        tft.pushColors(px, w * h, false);
+    }
+}
+
 void IRAM_ATTR bsp_display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
+    uint16_t* px = (uint16_t*)&color_p->full;
+    
+    Perf.flushBegin();
+    uint32_t start = micros();
+    flushWindows = 0;
     
+    // LVGL only flushes once the previous buffer was released, so the bus
+    // is idle here. With DMA the transfer runs while LVGL renders into the
+    // other buffer; bsp_display_flush_poll() releases this one when done.
     tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t*)&color_p->full, w * h, false);
-    tft.endWrite();
     
+    uint32_t sent = flushFilter.flush(area->x1, area->y1, area->x2, area->y2, px, pushRun);
+    
+    if (dmaEnabled && sent > 0) {
+        Perf.flushBlocked(micros() - start);
+        flush_job_t job = { disp, start, sent * w, flushWindows };
+        flushDma.start(job);
+        return;
+    }
+    
+    tft.endWrite();
+    uint32_t elapsed = micros() - start;
+    Perf.flushBlocked(elapsed);
+    Perf.flushEnd(elapsed, sent * w, flushWindows,
+                  sent * w * sizeof(lv_color_t) + flushWindows * FLUSH_WINDOW_BYTES,
+                  lv_disp_flush_is_last(disp));
     lv_disp_flush_ready(disp);
 }
 
-void bsp_touch_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data) {
-    if (!touchscreen) {
-        data->state = LV_INDEV_STATE_REL;
+void bsp_display_flush_poll(bool wait) {
+    // Blocks on the SPI driver's completion queue, not a busy loop
+    uint32_t waitStart = micros();
+    flush_job_t job;
+    if (!flushDma.complete(wait, &job)) {
         return;
     }
+    uint32_t now = micros();
+    lv_disp_drv_t* disp = (lv_disp_drv_t*)job.disp;
     
-    if (touchscreen->tirqTouched() && touchscreen->touched()) {
-        TS_Point p = touchscreen->getPoint();
-        
-        int16_t x = map(p.x, 200, 3700, 1, BSP_DISPLAY_WIDTH);
-        int16_t y = map(p.y, 240, 3800, 1, BSP_DISPLAY_HEIGHT);
-        
-        x = constrain(x, 0, BSP_DISPLAY_WIDTH - 1);
-        y = constrain(y, 0, BSP_DISPLAY_HEIGHT - 1);
-        
-        lastX = x;
-        lastY = y;
-        
-        data->point.x = x;
-        data->point.y = y;
-        data->state = LV_INDEV_STATE_PR;
+    if (wait) {
+        Perf.flushBlocked(now - waitStart);
+    }
+    Perf.flushEnd(now - job.startUs, job.pixels, job.windows,
+                  job.pixels * sizeof(lv_color_t) + job.windows * FLUSH_WINDOW_BYTES,
+                  lv_disp_flush_is_last(disp));
+    lv_disp_flush_ready(disp);
+}
+
+static void bsp_display_wait(lv_disp_drv_t *disp) {
+    bsp_display_flush_poll(true);
+}
+
+static void bsp_display_render_start(lv_disp_drv_t *disp_drv) {
+    lv_disp_t* disp = _lv_refr_get_disp_refreshing();
+    flush_area_t inv[FLUSH_MAX_AREAS];
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        const lv_area_t& a = disp->inv_areas[i];
+        inv[i] = { a.x1, a.y1, a.x2, a.y2 };
+    }
+    uint32_t dirtyPx = 0;
+    uint32_t overdrawPx = 0;
+    uint16_t merged = flush_merge_areas(inv, disp->inv_area_joined, disp->inv_p,
+                                        overdrawBudgetPct, &dirtyPx, &overdrawPx);
+    
+    uint16_t areas = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) {
+            lv_area_set(&disp->inv_areas[i], inv[i].x1, inv[i].y1, inv[i].x2, inv[i].y2);
+            areas++;
+        }
+    }
+    Perf.frameBegin(areas, merged, dirtyPx, overdrawPx);
+}
+
+static bool allocDrawBuffers(uint32_t totalKB) {
+    const uint32_t lineBytes = BSP_DISPLAY_WIDTH * sizeof(lv_color_t);
+    int buffers = dmaEnabled ? 2 : 1;
+    
+    uint32_t lines = flush_buffer_lines(totalKB, lineBytes, BSP_DISPLAY_HEIGHT,
+                                        heap_caps_get_free_size(MALLOC_CAP_DMA),
+                                        heap_caps_get_largest_free_block(MALLOC_CAP_DMA), &buffers);
+    
+    vdbPixels = BSP_DISPLAY_WIDTH * lines;
+    buf1 = (lv_color_t*)heap_caps_malloc(vdbPixels * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    if (!buf1) {
+        return false;
+    }
+    if (buffers == 2) {
+        buf2 = (lv_color_t*)heap_caps_malloc(vdbPixels * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    }
+    return true;
+}
+
+// One SPI transaction. Each transfer16() returns the previous command's
+// result while starting the next one. Each axis is the median of
+// TOUCH_OVERSAMPLE conversions. Returns false when the pen is up or even
+// the middle three conversions disagree, as they do while the pen lands
+// or lifts.
+static bool touchSample(int16_t* rx, int16_t* ry) {
+    int16_t xs[TOUCH_OVERSAMPLE];
+    int16_t ys[TOUCH_OVERSAMPLE];
+    
+    touchSPI.beginTransaction(SPISettings(SPI_TOUCH_FREQUENCY, MSBFIRST, SPI_MODE0));
+    digitalWrite(touchCsPin, LOW);
+    touchSPI.transfer(XPT_CMD_Z1);
+    int16_t z1 = touchSPI.transfer16(XPT_CMD_Z2) >> 3;
+    int16_t z2 = touchSPI.transfer16(XPT_CMD_X) >> 3;
+    int z = z1 + 4095 - z2;
+    bool down = z >= TOUCH_Z_THRESHOLD;
+    if (down) {
+        // The first X after switching inputs has not settled
+        touchSPI.transfer16(XPT_CMD_X);
+        for (int i = 0; i < TOUCH_OVERSAMPLE; i++) {
+            xs[i] = touchSPI.transfer16(XPT_CMD_Y) >> 3;
+            ys[i] = touchSPI.transfer16(i < TOUCH_OVERSAMPLE - 1 ? XPT_CMD_X : XPT_CMD_PD) >> 3;
+        }
+    } else {
+        touchSPI.transfer16(XPT_CMD_PD);
+    }
+    touchSPI.transfer16(0);
+    digitalWrite(touchCsPin, HIGH);
+    touchSPI.endTransaction();
+    
+    return down && touch_median(xs, TOUCH_OVERSAMPLE, TOUCH_MAX_SPREAD, rx) &&
+           touch_median(ys, TOUCH_OVERSAMPLE, TOUCH_MAX_SPREAD, ry);
+}
+
+static bool touchPush(const touch_sample_t& s) {
+    uint32_t head = touchHead;
+    if (head - touchTail >= TOUCH_RING_LEN) {
+        return false;
+    }
+    touchRing[head & (TOUCH_RING_LEN - 1)] = s;
+    __atomic_store_n(&touchHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool touchPeek(touch_sample_t* s) {
+    uint32_t tail = touchTail;
+    if (__atomic_load_n(&touchHead, __ATOMIC_ACQUIRE) == tail) {
+        return false;
+    }
+    *s = touchRing[tail & (TOUCH_RING_LEN - 1)];
+    return true;
+}
+
+static void touchPop() {
+    __atomic_store_n(&touchTail, touchTail + 1, __ATOMIC_RELEASE);
+}
+
+static void IRAM_ATTR touchIrqHandler() {
+    touchIrqUs = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touchTaskHandle, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void touchTaskEntry(void* arg) {
+    bool down = false;
+    uint8_t misses = 0;
+    
+    while (true) {
+        if (!down) {
+            TickType_t wait = touchIrqPin >= 0 ? portMAX_DELAY : pdMS_TO_TICKS(TOUCH_POLL_MS);
+            ulTaskNotifyTake(pdTRUE, wait);
+        }
         
-        if (touchFpsOptimizeEnabled) {
-            Perf.setRefreshInterval(200);
+        touch_sample_t s;
+        int16_t rx, ry;
+        if (touchSample(&rx, &ry)) {
+            misses = 0;
+            touch_calibrate(touchCal, rx, ry, BSP_DISPLAY_WIDTH, BSP_DISPLAY_HEIGHT, &s.x, &s.y);
+            s.pressed = true;
+            s.us = !down && touchIrqPin >= 0 ? touchIrqUs : micros();
+            if (!touchPush(s)) {
+                touchDropped++;
+            } else if (!down) {
+                Perf.wake();
+            }
+            down = true;
+        } else if (down && ++misses >= 2) {
+            // An unstable reading alone is not a release
+            down = false;
+            misses = 0;
+            s.x = 0;
+            s.y = 0;
+            s.pressed = false;
+            s.us = micros();
+            while (!touchPush(s)) {
+                vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+            }
         }
         
+        if (down) {
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+        }
+        // Our own conversions pulse PENIRQ; drop those notifications
+        ulTaskNotifyTake(pdTRUE, 0);
+    }
+}
+
+// Runs on the LVGL task before each timer pass
+void bsp_touch_poll_irq(void) {
+    touch_sample_t s;
+    if (touchPaused && touchPeek(&s)) {
+        touchPaused = false;
+        touchIdleReads = 0;
+        lv_timer_resume(indev_drv.read_timer);
+        lv_timer_ready(indev_drv.read_timer);
+        if (s.pressed) {
+            Perf.inputEvent(s.us);
+        }
+    }
+}
+
+// LVGL 8.3 advances scroll throw, and the elastic or snap settle after it,
+// only from released reads, so the read timer has to run until they end.
+static bool touchScrollSettled(void) {
+    lv_indev_t* indev = lv_indev_get_act();
+    if (!indev) {
+        return true;
+    }
+    return indev->proc.types.pointer.scroll_obj == NULL &&
+           indev->proc.types.pointer.scroll_throw_vect.x == 0 &&
+           indev->proc.types.pointer.scroll_throw_vect.y == 0;
+}
+
+// Reports queued points one by one; LVGL calls again while more remain
+void bsp_touch_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data) {
+    touch_sample_t s;
+    if (touchPeek(&s)) {
+        touchPop();
+        lastPressed = s.pressed;
+        if (s.pressed) {
+            lastX = s.x;
+            lastY = s.y;
+        }
+        data->continue_reading = touchPeek(&s);
+    }
+    
+    data->point.x = lastX;
+    data->point.y = lastY;
+    
+    if (lastPressed) {
+        data->state = LV_INDEV_STATE_PR;
+        touchIdleReads = 0;
         Power.resetIdleTimer();
     } else {
-        data->point.x = lastX;
-        data->point.y = lastY;
         data->state = LV_INDEV_STATE_REL;
-        
-        if (touchFpsOptimizeEnabled) {
-            Perf.setRefreshInterval(5);
+        // The sampling task wakes us with the next press. Idle reads are
+        // only counted once a scroll throw has finished.
+        if (!touchScrollSettled()) {
+            touchIdleReads = 0;
+        } else if (touchTaskHandle && !data->continue_reading &&
+                   ++touchIdleReads >= TOUCH_IDLE_READS) {
+            touchPaused = true;
+            lv_timer_pause(indev_driver->read_timer);
         }
     }
 }
 
-void bsp_set_touch_fps_optimize(bool enable) {
-    touchFpsOptimizeEnabled = enable;
-}
-
 bool bsp_display_init(void) {
     Serial.println("[BSP] Initializing display...");
     
@@ -106,18 +394,40 @@ bool bsp_display_init(void) {
         tft.invertDisplay(true);
     }
     
-    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, VDB_BUFFER_SIZE);
+    flushFilter.invalidate();
+    
+    dmaEnabled = tft.initDMA();
+    overdrawBudgetPct = cfg.overdrawPct;
+    
+    if (!allocDrawBuffers(cfg.vdbBufferSizeKB)) {
+        Serial.println("  VDB alloc: FAILED");
+        return false;
+    }
+    
+    // With one buffer LVGL has to wait for every transfer anyway
+    if (!buf2) {
+        dmaEnabled = false;
+    }
+    
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, vdbPixels);
     
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = BSP_DISPLAY_WIDTH;
     disp_drv.ver_res = BSP_DISPLAY_HEIGHT;
     disp_drv.flush_cb = bsp_display_flush;
+    disp_drv.render_start_cb = bsp_display_render_start;
+    if (dmaEnabled) {
+        disp_drv.wait_cb = bsp_display_wait;
+    }
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
     
     displayReady = true;
-    Serial.printf("  VDB buffer: %d pixels (double buffer)\n", VDB_BUFFER_SIZE);
-    Serial.printf("  VDB size: %d bytes per buffer\n", VDB_BUFFER_SIZE * sizeof(lv_color_t));
+    Serial.printf("  VDB buffer: %u pixels (%u lines, %s)\n", vdbPixels, vdbPixels / BSP_DISPLAY_WIDTH,
+        buf2 ? "double buffer" : "single buffer");
+    Serial.printf("  VDB size: %u bytes per buffer\n", vdbPixels * sizeof(lv_color_t));
+    Serial.printf("  Flush: %s\n", dmaEnabled ? "SPI DMA" : "blocking");
+    Serial.printf("  Overdraw budget: %u%%\n", overdrawBudgetPct);
     Serial.println("  Display init: OK");
     return true;
 }
@@ -132,20 +442,41 @@ bool bsp_touch_init(void) {
     
     touchSPI.begin(cfg.spiClk, cfg.spiMiso, cfg.spiMosi, cfg.spiCs);
     
-    touchscreen = new XPT2046_Touchscreen(cfg.spiCs, cfg.pinIrq);
+    touchCsPin = cfg.spiCs;
+    pinMode(touchCsPin, OUTPUT);
+    digitalWrite(touchCsPin, HIGH);
     
-    if (!touchscreen->begin(touchSPI)) {
-        Serial.println("  Touch init: FAILED");
-        return false;
+    touch_load_calibration(cfg.calibrationMatrix, BSP_DISPLAY_WIDTH, BSP_DISPLAY_HEIGHT, &touchCal);
+    
+    if (cfg.pinIrq >= 0) {
+        touchIrqPin = cfg.pinIrq;
+        pinMode(touchIrqPin, INPUT);
     }
     
-    touchscreen->setRotation(1);
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        touchTaskEntry,
+        "TouchTask",
+        TOUCH_TASK_STACK,
+        NULL,
+        TOUCH_TASK_PRIORITY,
+        &touchTaskHandle,
+        0
+    );
+    if (ret != pdPASS) {
+        Serial.println("  Touch init: FAILED (task)");
+        touchTaskHandle = nullptr;
+        return false;
+    }
     
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = bsp_touch_read;
     lv_indev_drv_register(&indev_drv);
     
+    if (touchIrqPin >= 0) {
+        attachInterrupt(digitalPinToInterrupt(touchIrqPin), touchIrqHandler, FALLING);
+    }
+    
     touchReady = true;
     Serial.println("  Touch init: OK");
     return true;
@@ -269,7 +600,7 @@ void bsp_print_status(void) {
     Serial.println("-------------------");
     Serial.printf("  Display:  %s (%dx%d)\n", 
         displayReady ? "READY" : "NOT READY", BSP_DISPLAY_WIDTH, BSP_DISPLAY_HEIGHT);
-    Serial.printf("  Touch:    %s\n", touchReady ? "READY" : "NOT READY");
+    Serial.printf("  Touch:    %s (%u points dropped)\n", touchReady ? "READY" : "NOT READY", touchDropped);
     Serial.printf("  SPIFFS:   %s\n", spiffsReady ? "READY" : "NOT READY");
     Serial.printf("  SD Card:  %s\n", sdReady ? "READY" : "NOT READY");
     Serial.printf("  Backlight: %d/255\n", currentBacklight);
@@ -5,7 +5,7 @@
 #include <lvgl.h>
 #include <SPI.h>
 #include <SD.h>
-#include <XPT2046_Touchscreen.h>
+#include "TouchFilter.h"
 
 #define BSP_DISPLAY_WIDTH  320
 #define BSP_DISPLAY_HEIGHT 240
@@ -16,15 +16,6 @@
 #define BSP_LDR_PIN    34
 #define BSP_BACKLIGHT_PIN 21
 
-typedef struct {
-    float a;
-    float b;
-    float c;
-    float d;
-    float e;
-    float f;
-} bsp_touch_cal_matrix_t;
-
 typedef enum {
     BSP_OK = 0,
     BSP_ERR_DISPLAY_INIT,
@@ -34,8 +25,6 @@ typedef enum {
     BSP_ERR_STORAGE_INIT
 } bsp_err_t;
 
-extern XPT2046_Touchscreen* touchscreen;
-
 void bsp_init(void);
 bool bsp_display_init(void);
 bool bsp_touch_init(void);
@@ -58,9 +47,9 @@ bool bsp_is_sd_ready(void);
 bool bsp_is_spiffs_ready(void);
 
 void bsp_display_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+void bsp_display_flush_poll(bool wait);
 void bsp_touch_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data);
-
-void bsp_set_touch_fps_optimize(bool enable);
+void bsp_touch_poll_irq(void);
 
 void bsp_print_status(void);
 
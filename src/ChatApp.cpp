@@ -3,6 +3,8 @@
 #include "FileExplorerApp.h"
 #include "LvZhFont.h"
 #include "BSP.h"
+#include "Performance.h"
+#include "IOScheduler.h"
 #include <SD.h>
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
@@ -54,17 +56,41 @@ ChatApp::ChatApp() : BaseApp("Chat") {
     _msgCount = 0;
     _selectedModelIndex = 0;
     _netTaskHandle = nullptr;
+    _netRunning = false;
+    _netCancel = false;
     _pendingMessage[0] = '\0';
     _responseContent[0] = '\0';
-    _responseReady = false;
     _systemPrompt[0] = '\0';
     _promptPath[0] = '\0';
 }
 
 ChatApp::~ChatApp() {
+    // ~BaseApp only reaches BaseApp::onDestroy, so stop the task here too
+    stopNetworkTask();
     clearMessages();
 }
 
+void ChatApp::onDestroy() {
+    // Before BaseApp cancels queued UI callbacks, so none can be posted after
+    stopNetworkTask();
+    BaseApp::onDestroy();
+}
+
+// Blocks until the network task no longer references this app. The receive
+// loop drops the response on its next pass; a connect in progress has to
+// run into its own timeout first.
+void ChatApp::stopNetworkTask() {
+    if (!_netRunning) {
+        return;
+    }
+    Serial.println("[ChatApp] Waiting for network task");
+    _netCancel = true;
+    while (_netRunning) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    _isWaitingResponse = false;
+}
+
 bool ChatApp::createUI() {
     Serial.println("[ChatApp] createUI start");
     
@@ -141,8 +167,6 @@ bool ChatApp::onResume() {
         return false;
     }
     
-    bsp_set_touch_fps_optimize(true);
-    
     checkPendingFile();
     checkPendingPromptFile();
     
@@ -152,76 +176,87 @@ bool ChatApp::onResume() {
 void ChatApp::onPause() {
     Serial.println("[ChatApp] onPause");
     
-    bsp_set_touch_fps_optimize(false);
-    
     BaseApp::onPause();
 }
 
 void ChatApp::saveState() {
     if (!_dataFolderReady) return;
     
-    File stateFile = SD.open("/ChatApp/.state", FILE_WRITE);
-    if (!stateFile) {
+    String state;
+    state.reserve(CHAT_INPUT_MAX_LEN + 256);
+    state += "chat_path=";
+    state += _currentChatPath;
+    state += "\ninput_text=";
+    state += _inputArea ? lv_textarea_get_text(_inputArea) : "";
+    state += "\nmodel_index=";
+    state += _selectedModelIndex;
+    state += "\nprompt_path=";
+    state += _promptPath;
+    state += "\n";
+    
+    if (!SdIO.write("/ChatApp/.state", state.c_str(), state.length(), IO_PRIO_BACKGROUND)) {
         Serial.println("[ChatApp] Failed to save state");
         return;
     }
-    
-    stateFile.printf("chat_path=%s\n", _currentChatPath);
-    stateFile.printf("input_text=%s\n", _inputArea ? lv_textarea_get_text(_inputArea) : "");
-    stateFile.printf("model_index=%d\n", _selectedModelIndex);
-    stateFile.printf("prompt_path=%s\n", _promptPath);
-    
-    stateFile.close();
     Serial.println("[ChatApp] State saved");
 }
 
+// Strips surrounding whitespace in place, as String::trim() does
+static char* trimText(char* text) {
+    while (*text && isspace((unsigned char)*text)) text++;
+    char* end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) end--;
+    *end = '\0';
+    return text;
+}
+
+// Reads a small SD file as a string through the IO task, which runs it
+// after any queued writes to the same path. -1 if it does not exist.
+static int readTextFile(const char* path, char* buf, size_t size) {
+    int n = SdIO.read(path, buf, size - 1, IO_PRIO_INTERACTIVE);
+    buf[n > 0 ? n : 0] = '\0';
+    return n;
+}
+
 bool ChatApp::loadState() {
     if (!_sdCardAvailable) return false;
     
-    if (!SD.exists("/ChatApp/.state")) {
+    char state[CHAT_INPUT_MAX_LEN + CHAT_PATH_MAX_LEN * 2 + 64];
+    if (readTextFile("/ChatApp/.state", state, sizeof(state)) < 0) {
         Serial.println("[ChatApp] No state file found");
         return false;
     }
     
-    File stateFile = SD.open("/ChatApp/.state");
-    if (!stateFile) {
-        return false;
-    }
-    
     char chatPath[CHAT_PATH_MAX_LEN] = "";
     char inputText[CHAT_INPUT_MAX_LEN] = "";
     char promptPath[CHAT_PATH_MAX_LEN] = "";
     int modelIndex = 0;
     
-    while (stateFile.available()) {
-        String line = stateFile.readStringUntil('\n');
-        line.trim();
+    char* next = nullptr;
+    for (char* raw = strtok_r(state, "\n", &next); raw; raw = strtok_r(nullptr, "\n", &next)) {
+        char* line = trimText(raw);
         
-        if (line.startsWith("chat_path=")) {
-            strncpy(chatPath, line.c_str() + 10, CHAT_PATH_MAX_LEN - 1);
-        } else if (line.startsWith("input_text=")) {
-            strncpy(inputText, line.c_str() + 11, CHAT_INPUT_MAX_LEN - 1);
-        } else if (line.startsWith("model_index=")) {
-            modelIndex = atoi(line.c_str() + 12);
+        if (strncmp(line, "chat_path=", 10) == 0) {
+            strncpy(chatPath, line + 10, CHAT_PATH_MAX_LEN - 1);
+        } else if (strncmp(line, "input_text=", 11) == 0) {
+            strncpy(inputText, line + 11, CHAT_INPUT_MAX_LEN - 1);
+        } else if (strncmp(line, "model_index=", 12) == 0) {
+            modelIndex = atoi(line + 12);
             if (modelIndex < 0 || modelIndex >= (int)AI_MODEL_COUNT) {
                 modelIndex = 0;
             }
-        } else if (line.startsWith("prompt_path=")) {
-            strncpy(promptPath, line.c_str() + 12, CHAT_PATH_MAX_LEN - 1);
+        } else if (strncmp(line, "prompt_path=", 12) == 0) {
+            strncpy(promptPath, line + 12, CHAT_PATH_MAX_LEN - 1);
         }
     }
     
-    stateFile.close();
-    
     _selectedModelIndex = modelIndex;
     
-    if (promptPath[0] != '\0' && SD.exists(promptPath)) {
-        loadPromptFromFile(promptPath);
+    if (promptPath[0] != '\0' && loadPromptFromFile(promptPath)) {
         Serial.printf("[ChatApp] Restored prompt: %s\n", promptPath);
     }
     
-    if (chatPath[0] != '\0' && SD.exists(chatPath)) {
-        loadChatFromFile(chatPath);
+    if (chatPath[0] != '\0' && loadChatFromFile(chatPath)) {
         Serial.printf("[ChatApp] Restored chat: %s\n", chatPath);
     }
     
@@ -236,21 +271,16 @@ bool ChatApp::loadState() {
 void ChatApp::checkPendingFile() {
     if (!_sdCardAvailable) return;
     
-    if (!SD.exists("/ChatApp/.pending_file")) {
+    char pending[IO_PATH_MAX + 8];
+    if (readTextFile("/ChatApp/.pending_file", pending, sizeof(pending)) < 0) {
         return;
     }
+    SdIO.remove("/ChatApp/.pending_file", IO_PRIO_NORMAL);
     
-    File pendingFile = SD.open("/ChatApp/.pending_file");
-    if (!pendingFile) return;
-    
-    String path = pendingFile.readStringUntil('\n');
-    path.trim();
-    pendingFile.close();
-    
-    SD.remove("/ChatApp/.pending_file");
-    
-    if (path.length() > 0) {
-        processPendingFile(path.c_str());
+    pending[strcspn(pending, "\n")] = '\0';
+    char* path = trimText(pending);
+    if (path[0] != '\0') {
+        processPendingFile(path);
     }
 }
 
@@ -267,25 +297,20 @@ void ChatApp::processPendingFile(const char* path) {
 void ChatApp::checkPendingPromptFile() {
     if (!_sdCardAvailable) return;
     
-    if (!SD.exists("/ChatApp/.pending_prompt")) {
+    char pending[IO_PATH_MAX + 8];
+    if (readTextFile("/ChatApp/.pending_prompt", pending, sizeof(pending)) < 0) {
         return;
     }
+    SdIO.remove("/ChatApp/.pending_prompt", IO_PRIO_NORMAL);
     
-    File pendingFile = SD.open("/ChatApp/.pending_prompt");
-    if (!pendingFile) return;
-    
-    String path = pendingFile.readStringUntil('\n');
-    path.trim();
-    pendingFile.close();
-    
-    SD.remove("/ChatApp/.pending_prompt");
-    
-    if (path.length() > 0) {
-        loadPromptFromFile(path.c_str());
+    pending[strcspn(pending, "\n")] = '\0';
+    char* path = trimText(pending);
+    if (path[0] != '\0') {
+        loadPromptFromFile(path);
     }
 }
 
-void ChatApp::loadPromptFromFile(const char* path) {
+bool ChatApp::loadPromptFromFile(const char* path) {
     Serial.printf("[ChatApp] Loading prompt from: %s\n", path);
     
     const char* actualPath = path;
@@ -293,23 +318,14 @@ void ChatApp::loadPromptFromFile(const char* path) {
         actualPath = path + 2;
     }
     
-    if (!SD.exists(actualPath)) {
+    // Room for leading whitespace that trimming drops
+    char content[CHAT_PROMPT_MAX_LEN + 64];
+    if (readTextFile(actualPath, content, sizeof(content)) < 0) {
         Serial.printf("[ChatApp] Prompt file not found: %s\n", actualPath);
-        return;
-    }
-    
-    File promptFile = SD.open(actualPath);
-    if (!promptFile) {
-        Serial.println("[ChatApp] Failed to open prompt file");
-        return;
+        return false;
     }
     
-    String content = promptFile.readString();
-    promptFile.close();
-    
-    content.trim();
-    
-    strncpy(_systemPrompt, content.c_str(), CHAT_PROMPT_MAX_LEN - 1);
+    strncpy(_systemPrompt, trimText(content), CHAT_PROMPT_MAX_LEN - 1);
     _systemPrompt[CHAT_PROMPT_MAX_LEN - 1] = '\0';
     
     strncpy(_promptPath, actualPath, CHAT_PATH_MAX_LEN - 1);
@@ -317,6 +333,7 @@ void ChatApp::loadPromptFromFile(const char* path) {
     
     Serial.printf("[ChatApp] Loaded prompt (%d bytes): %.50s...\n", 
         strlen(_systemPrompt), _systemPrompt);
+    return true;
 }
 
 void ChatApp::destroyUI() {
@@ -376,15 +393,14 @@ void ChatApp::clearSidebarButtons() {
     Serial.println("[ChatApp] Sidebar buttons cleared");
 }
 
-bool ChatApp::initDataFolder() {
-    if (!_sdCardAvailable) return false;
-    
+// Runs on the IO task
+int ChatApp::init_folders_io(void* ctx) {
     if (!SD.exists("/ChatApp")) {
         if (SD.mkdir("/ChatApp")) {
             Serial.println("[ChatApp] Created /ChatApp folder");
         } else {
             Serial.println("[ChatApp] Failed to create /ChatApp folder");
-            return false;
+            return -1;
         }
     }
     
@@ -392,7 +408,7 @@ bool ChatApp::initDataFolder() {
         if (SD.mkdir("/ChatApp/chats")) {
             Serial.println("[ChatApp] Created /ChatApp/chats folder");
         } else {
-            return false;
+            return -1;
         }
     }
     
@@ -400,9 +416,18 @@ bool ChatApp::initDataFolder() {
         if (SD.mkdir("/ChatApp/prompts")) {
             Serial.println("[ChatApp] Created /ChatApp/prompts folder");
         } else {
-            return false;
+            return -1;
         }
     }
+    return 0;
+}
+
+bool ChatApp::initDataFolder() {
+    if (!_sdCardAvailable) return false;
+    
+    if (SdIO.run(init_folders_io, nullptr, IO_PRIO_INTERACTIVE) < 0) {
+        return false;
+    }
     
     _nextChatIndex = getNextChatIndex();
     _dataFolderReady = true;
@@ -411,31 +436,28 @@ bool ChatApp::initDataFolder() {
     return true;
 }
 
+// Runs on the IO task for each entry of /ChatApp/chats
+bool ChatApp::chat_index_cb(const char* name, bool isDir, size_t size, void* ctx) {
+    if (isDir) return true;
+    
+    const char* lastSlash = strrchr(name, '/');
+    const char* filename = lastSlash ? lastSlash + 1 : name;
+    
+    int* maxIndex = (int*)ctx;
+    int index = 0;
+    if (sscanf(filename, "%d", &index) == 1) {
+        if (index > *maxIndex) *maxIndex = index;
+    }
+    return true;
+}
+
 int ChatApp::getNextChatIndex() {
     if (!_sdCardAvailable) return 1;
     
     int maxIndex = 0;
-    File chatsDir = SD.open("/ChatApp/chats");
-    if (!chatsDir || !chatsDir.isDirectory()) {
+    if (SdIO.list("/ChatApp/chats", chat_index_cb, &maxIndex, IO_PRIO_INTERACTIVE) < 0) {
         return 1;
     }
-    
-    File file = chatsDir.openNextFile();
-    while (file) {
-        if (!file.isDirectory()) {
-            const char* name = file.name();
-            const char* lastSlash = strrchr(name, '/');
-            const char* filename = lastSlash ? lastSlash + 1 : name;
-            
-            int index = 0;
-            if (sscanf(filename, "%d", &index) == 1) {
-                if (index > maxIndex) maxIndex = index;
-            }
-        }
-        file = chatsDir.openNextFile();
-    }
-    chatsDir.close();
-    
     return maxIndex + 1;
 }
 
@@ -478,41 +500,77 @@ void ChatApp::appendMessageToFile(const char* text, bool isSent) {
         snprintf(_currentChatPath, sizeof(_currentChatPath), "/ChatApp/chats/%d.txt", _nextChatIndex++);
     }
     
-    File file = SD.open(_currentChatPath, FILE_APPEND);
-    if (!file) {
-        Serial.printf("[ChatApp] Failed to open file for appending: %s\n", _currentChatPath);
+    // Escaping can at most double the text
+    size_t cap = strlen(text) * 2 + 16;
+    char* line = (char*)malloc(cap);
+    if (!line) {
+        Serial.printf("[ChatApp] Failed to append to %s\n", _currentChatPath);
         return;
     }
     
     const char* role = isSent ? "user" : "order";
-    file.printf("[%s] ", role);
+    size_t len = snprintf(line, cap, "[%s] ", role);
     
     for (const char* p = text; *p; p++) {
         if (*p == '\n') {
-            file.print("\\n");
+            line[len++] = '\\';
+            line[len++] = 'n';
         } else if (*p == '\r') {
             // skip
         } else if (*p == '\\') {
-            file.print("\\\\");
+            line[len++] = '\\';
+            line[len++] = '\\';
         } else {
-            file.print(*p);
+            line[len++] = *p;
         }
     }
-    file.print("\n");
-    file.close();
+    line[len++] = '\n';
+    
+    bool queued = SdIO.append(_currentChatPath, line, len, IO_PRIO_NORMAL);
+    free(line);
+    if (!queued) {
+        Serial.printf("[ChatApp] Failed to append to %s\n", _currentChatPath);
+        return;
+    }
     
     Serial.printf("[ChatApp] Appended message to %s\n", _currentChatPath);
 }
 
+typedef struct {
+    ChatApp* app;
+    const char* path;
+} chat_load_t;
+
+// Runs on the IO task while the UI task waits in loadChatFromFile(), so it
+// may rebuild the message list but not touch LVGL
+int ChatApp::load_chat_io(void* ctx) {
+    chat_load_t* load = (chat_load_t*)ctx;
+    File file = SD.open(load->path);
+    if (!file) {
+        return -1;
+    }
+    load->app->readChat(file, load->path);
+    file.close();
+    return 0;
+}
+
 bool ChatApp::loadChatFromFile(const char* path) {
     if (!_sdCardAvailable || !path) return false;
     
-    File file = SD.open(path);
-    if (!file) {
+    // Queued behind the appends to this chat, so it reads them back
+    chat_load_t load = {this, path};
+    if (SdIO.run(load_chat_io, &load, IO_PRIO_INTERACTIVE, path) < 0) {
         Serial.printf("[ChatApp] Failed to open file: %s\n", path);
         return false;
     }
     
+    refreshMessageDisplay();
+    Serial.printf("[ChatApp] Loaded %d messages from %s\n", _msgCount, path);
+    
+    return true;
+}
+
+void ChatApp::readChat(fs::File& file, const char* path) {
     clearMessages();
     strncpy(_currentChatPath, path, CHAT_PATH_MAX_LEN - 1);
     
@@ -557,12 +615,6 @@ bool ChatApp::loadChatFromFile(const char* path) {
             addMessageToList(text, isSent);
         }
     }
-    
-    file.close();
-    refreshMessageDisplay();
-    Serial.printf("[ChatApp] Loaded %d messages from %s\n", _msgCount, path);
-    
-    return true;
 }
 
 void ChatApp::clearMessages() {
@@ -645,6 +697,7 @@ lv_obj_t* ChatApp::createMessageBubble(lv_color_t bgColor, const char* text) {
     }
     
     lv_obj_t* label = lv_label_create(bubble);
+    LvZhFontMgr.prefetch(displayText);
     lv_label_set_text(label, displayText);
     lv_obj_set_style_text_color(label, lv_color_make(0x20, 0x20, 0x20), 0);
     
@@ -754,25 +807,42 @@ void ChatApp::onFileSelected(const char* path) {
 void ChatApp::onUpdate() {
     static uint32_t lastCheck = 0;
     if (_isWaitingResponse && millis() - lastCheck > 2000) {
-        Serial.printf("[ChatApp] onUpdate: waiting=%d, responseReady=%d\n", 
-            _isWaitingResponse, _responseReady);
+        Serial.printf("[ChatApp] onUpdate: waiting=%d\n", _isWaitingResponse);
         lastCheck = millis();
     }
-    
-    if (_responseReady) {
-        Serial.printf("[ChatApp] onUpdate: response ready, len=%d\n", strlen(_responseContent));
-        _responseReady = false;
-        _isWaitingResponse = false;
-        
-        if (_responseContent[0] != '\0') {
-            addMessage(_responseContent, false);
-            Serial.printf("[ChatApp] AI response displayed: %d bytes\n", strlen(_responseContent));
+}
+
+// Called on the network task once _responseContent is final. The content
+// stays in place; only the notification goes through the UI queue. Nothing
+// is posted once the app is being destroyed.
+void ChatApp::postResponse() {
+    int retries = 0;
+    while (!_netCancel && !Perf.postUi(response_ready_cb, this)) {
+        if (++retries > CHAT_POST_RETRIES) {
+            Serial.println("[ChatNet] UI queue full, response dropped");
+            _isWaitingResponse = false;
+            return;
         }
-        
-        _responseContent[0] = '\0';
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
 }
 
+void ChatApp::response_ready_cb(void* ctx, const void* data) {
+    ((ChatApp*)ctx)->showResponse();
+}
+
+void ChatApp::showResponse() {
+    Serial.printf("[ChatApp] Response ready, len=%d\n", strlen(_responseContent));
+    _isWaitingResponse = false;
+    
+    if (_responseContent[0] != '\0') {
+        addMessage(_responseContent, false);
+        Serial.printf("[ChatApp] AI response displayed: %d bytes\n", strlen(_responseContent));
+    }
+    
+    _responseContent[0] = '\0';
+}
+
 void ChatApp::onFloatBtnClick() {
     Serial.println("[ChatApp] onFloatBtnClick");
     toggleInputPanel();
@@ -1197,9 +1267,10 @@ void ChatApp::sendAIRequestAsync(const char* userMessage) {
     }
     
     _isWaitingResponse = true;
+    _netCancel = false;
+    _netRunning = true;
     strncpy(_pendingMessage, userMessage, CHAT_INPUT_MAX_LEN - 1);
     _pendingMessage[CHAT_INPUT_MAX_LEN - 1] = '\0';
-    _responseReady = false;
     _responseContent[0] = '\0';
     
     Serial.println("[ChatApp] Creating network task...");
@@ -1219,6 +1290,7 @@ void ChatApp::sendAIRequestAsync(const char* userMessage) {
         _isWaitingResponse = false;
         addMessage("Error: Task create failed", false);
         _netTaskHandle = nullptr;
+        _netRunning = false;
     } else {
         Serial.println("[ChatApp] Network task started on Core 0");
     }
@@ -1233,10 +1305,11 @@ void ChatApp::networkTaskEntry(void* arg) {
     
     if (!success) {
         strcpy(app->_responseContent, "Error: Request failed");
-        app->_responseReady = true;
+        app->postResponse();
     }
     
     app->_netTaskHandle = nullptr;
+    app->_netRunning = false;
     
     Serial.println("[ChatNet] Task done");
     vTaskDelete(NULL);
@@ -1271,8 +1344,9 @@ bool ChatApp::performAIRequest(const char* userMessage) {
     const ai_model_config_t& model = AI_MODELS[_selectedModelIndex];
     Serial.printf("[ChatNet] Request to %s\n", model.name);
     
-    File tempFile = SD.open(CHAT_TEMP_FILE, FILE_WRITE);
-    if (!tempFile) {
+    // The response is streamed to the temp file as background appends, so
+    // the IO task batches them and keeps interactive reads ahead of them
+    if (!SdIO.write(CHAT_TEMP_FILE, nullptr, 0, IO_PRIO_BACKGROUND)) {
         Serial.println("[ChatNet] Failed to create temp file");
         return false;
     }
@@ -1300,8 +1374,7 @@ bool ChatApp::performAIRequest(const char* userMessage) {
     
     if (!client->connect(host, port)) {
         Serial.println("[ChatNet] Connection failed");
-        tempFile.close();
-        SD.remove(CHAT_TEMP_FILE);
+        SdIO.remove(CHAT_TEMP_FILE, IO_PRIO_BACKGROUND);
         delete client;
         return false;
     }
@@ -1348,6 +1421,13 @@ bool ChatApp::performAIRequest(const char* userMessage) {
     int totalBytes = 0;
     
     while (millis() - timeout < 30000) {
+        if (_netCancel) {
+            Serial.println("[ChatNet] App closed, dropping response");
+            client->stop();
+            delete client;
+            SdIO.remove(CHAT_TEMP_FILE, IO_PRIO_BACKGROUND);
+            return false;
+        }
         if (client->available()) {
             timeout = millis();
             char c = client->read();
@@ -1369,8 +1449,22 @@ bool ChatApp::performAIRequest(const char* userMessage) {
                 if (c == '\n') {
                     lineBuf[linePos] = '\0';
                     if (linePos > 0 && lineBuf[0] != '\r') {
-                        tempFile.println(lineBuf);
                         Serial.printf("[ChatNet] Body line: '%s'\n", lineBuf);
+                        lineBuf[linePos] = '\n';
+                        // Wait out a briefly full queue, but give up on the
+                        // response if the IO task stays stuck
+                        int retries = 0;
+                        while (!SdIO.append(CHAT_TEMP_FILE, lineBuf, linePos + 1, IO_PRIO_BACKGROUND)) {
+                            if (++retries > CHAT_APPEND_RETRIES) break;
+                            vTaskDelay(pdMS_TO_TICKS(10));
+                        }
+                        if (retries > CHAT_APPEND_RETRIES) {
+                            Serial.println("[ChatNet] IO queue full, aborting response");
+                            client->stop();
+                            delete client;
+                            SdIO.remove(CHAT_TEMP_FILE, IO_PRIO_BACKGROUND);
+                            return false;
+                        }
                     }
                     linePos = 0;
                 } else if (linePos < 1023) {
@@ -1393,7 +1487,6 @@ bool ChatApp::performAIRequest(const char* userMessage) {
     
     client->stop();
     delete client;
-    tempFile.close();
     
     Serial.println("[ChatNet] Response saved, parsing...");
     
@@ -1402,10 +1495,21 @@ bool ChatApp::performAIRequest(const char* userMessage) {
 }
 
 void ChatApp::processAIResponse() {
+    // Queued behind the appends to the same path, so it sees the whole file
+    SdIO.run(parse_response_io, this, IO_PRIO_NORMAL, CHAT_TEMP_FILE);
+    SdIO.remove(CHAT_TEMP_FILE, IO_PRIO_BACKGROUND);
+    postResponse();
+}
+
+int ChatApp::parse_response_io(void* ctx) {
+    static_cast<ChatApp*>(ctx)->parseResponseFile();
+    return 0;
+}
+
+void ChatApp::parseResponseFile() {
     if (!SD.exists(CHAT_TEMP_FILE)) {
         Serial.println("[ChatNet] Temp file not found");
         strcpy(_responseContent, "Error: No response");
-        _responseReady = true;
         return;
     }
     
@@ -1413,7 +1517,6 @@ void ChatApp::processAIResponse() {
     if (!tempFile) {
         Serial.println("[ChatNet] Failed to open temp file");
         strcpy(_responseContent, "Error: Read failed");
-        _responseReady = true;
         return;
     }
     
@@ -1483,10 +1586,8 @@ void ChatApp::processAIResponse() {
     }
     
     tempFile.close();
-    SD.remove(CHAT_TEMP_FILE);
     
     Serial.printf("[ChatNet] Final response (%d bytes): '%s'\n", contentLen, _responseContent);
-    _responseReady = true;
     Serial.printf("[ChatNet] Parsed response: %d bytes from %d lines\n", contentLen, lineCount);
 }
 
@@ -5,6 +5,7 @@
 #include "ZiranmaMapping.h"
 #include "GlobalUI.h"
 #include "api_config.h"
+#include <FS.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
@@ -14,6 +15,10 @@
 #define CHAT_PATH_MAX_LEN       48
 #define CHAT_PROMPT_MAX_LEN     256
 #define CHAT_TEMP_FILE          "/ChatApp/.response_temp"
+// Response line appends retried every 10 ms while the IO queue is full
+#define CHAT_APPEND_RETRIES     200
+// Response notifications retried every 10 ms while the UI queue is full
+#define CHAT_POST_RETRIES       200
 #define CHAT_NET_TASK_STACK     16384
 #define CHAT_NET_TASK_PRIORITY  3
 
@@ -58,9 +63,10 @@ private:
     int _selectedModelIndex;
     
     TaskHandle_t _netTaskHandle;
+    volatile bool _netRunning;      // set before the task starts, cleared as its last access to this
+    volatile bool _netCancel;       // app is going away, the task must not touch the UI
     char _pendingMessage[CHAT_INPUT_MAX_LEN];
     char _responseContent[CHAT_MSG_MAX_LEN];
-    bool _responseReady;
     
     char _systemPrompt[CHAT_PROMPT_MAX_LEN];
     char _promptPath[CHAT_PATH_MAX_LEN];
@@ -77,6 +83,10 @@ private:
     int getNextChatIndex();
     void appendMessageToFile(const char* text, bool isSent);
     bool loadChatFromFile(const char* path);
+    void readChat(fs::File& file, const char* path);
+    static int load_chat_io(void* ctx);
+    static int init_folders_io(void* ctx);
+    static bool chat_index_cb(const char* name, bool isDir, size_t size, void* ctx);
     void clearMessages();
     void addMessageToList(const char* text, bool isSent);
     
@@ -85,7 +95,7 @@ private:
     void checkPendingFile();
     void processPendingFile(const char* path);
     void checkPendingPromptFile();
-    void loadPromptFromFile(const char* path);
+    bool loadPromptFromFile(const char* path);
     
     static void float_btn_cb(lv_event_t* e);
     static void input_focus_cb(lv_event_t* e);
@@ -120,14 +130,22 @@ private:
     bool checkNetworkConnection();
     void sendAIRequestAsync(const char* userMessage);
     static void networkTaskEntry(void* arg);
+    void stopNetworkTask();
+    static void response_ready_cb(void* ctx, const void* data);
+    void postResponse();
+    void showResponse();
     bool performAIRequest(const char* userMessage);
     void processAIResponse();
+    void parseResponseFile();
+    static int parse_response_io(void* ctx);
     void parseSSELine(const char* line, char* content, int maxLen);
     
 public:
     ChatApp();
     ~ChatApp();
     
+    void onDestroy() override;
+    
     void onUpdate() override;
     app_info_t getInfo() const override;
     
@@ -16,6 +16,7 @@ void ConfigManager::loadDefaults() {
     displayConfig.height = 320;
     displayConfig.colorDepth = 16;
     displayConfig.vdbBufferSizeKB = 30;
+    displayConfig.overdrawPct = 25;
     displayConfig.spiMosi = 13;
     displayConfig.spiMiso = 12;
     displayConfig.spiClk = 14;
@@ -44,11 +45,16 @@ void ConfigManager::loadDefaults() {
     storageConfig.sdSpiMiso = 19;
     storageConfig.sdSpiClk = 18;
     storageConfig.sdSpiCs = 5;
+    storageConfig.cacheKB = 32;
+    storageConfig.readAheadKB = 4;
     
     strcpy(systemConfig.defaultTheme, "dark");
     strcpy(systemConfig.defaultFont, "F:/fonts/default_16.bin");
     strcpy(systemConfig.logLevel, "INFO");
     systemConfig.idleTimeoutSec = 300;
+    systemConfig.glyphCacheSize = 128;
+    systemConfig.glyphProfile = false;
+    systemConfig.uiBench = false;
     systemConfig.wifiAutoConnect = false;
     systemConfig.btEnabled = false;
     
@@ -62,6 +68,7 @@ void ConfigManager::loadFromNVS() {
     displayConfig.height = preferences.getUShort("height", displayConfig.height);
     displayConfig.colorDepth = preferences.getUChar("colorDepth", displayConfig.colorDepth);
     displayConfig.vdbBufferSizeKB = preferences.getUShort("vdbSize", displayConfig.vdbBufferSizeKB);
+    displayConfig.overdrawPct = preferences.getUChar("overdraw", displayConfig.overdrawPct);
     displayConfig.spiMosi = preferences.getChar("spiMosi", displayConfig.spiMosi);
     displayConfig.spiMiso = preferences.getChar("spiMiso", displayConfig.spiMiso);
     displayConfig.spiClk = preferences.getChar("spiClk", displayConfig.spiClk);
@@ -95,6 +102,8 @@ void ConfigManager::loadFromNVS() {
     storageConfig.sdSpiMiso = preferences.getChar("sdMiso", storageConfig.sdSpiMiso);
     storageConfig.sdSpiClk = preferences.getChar("sdClk", storageConfig.sdSpiClk);
     storageConfig.sdSpiCs = preferences.getChar("sdCs", storageConfig.sdSpiCs);
+    storageConfig.cacheKB = preferences.getUShort("cacheKB", storageConfig.cacheKB);
+    storageConfig.readAheadKB = preferences.getUChar("readAhead", storageConfig.readAheadKB);
     preferences.end();
     
     preferences.begin("system", true);
@@ -108,6 +117,9 @@ void ConfigManager::loadFromNVS() {
             preferences.getString("logLevel", systemConfig.logLevel).c_str(),
             sizeof(systemConfig.logLevel) - 1);
     systemConfig.idleTimeoutSec = preferences.getUShort("idleTimeout", systemConfig.idleTimeoutSec);
+    systemConfig.glyphCacheSize = preferences.getUShort("glyphCache", systemConfig.glyphCacheSize);
+    systemConfig.glyphProfile = preferences.getBool("glyphProf", systemConfig.glyphProfile);
+    systemConfig.uiBench = preferences.getBool("uiBench", systemConfig.uiBench);
     systemConfig.wifiAutoConnect = preferences.getBool("wifiAuto", systemConfig.wifiAutoConnect);
     systemConfig.btEnabled = preferences.getBool("btEnabled", systemConfig.btEnabled);
     preferences.end();
@@ -168,6 +180,7 @@ bool ConfigManager::parseJsonConfig(const char* jsonContent) {
         if (display.containsKey("height")) displayConfig.height = display["height"];
         if (display.containsKey("colorDepth")) displayConfig.colorDepth = display["colorDepth"];
         if (display.containsKey("vdbBufferSizeKB")) displayConfig.vdbBufferSizeKB = display["vdbBufferSizeKB"];
+        if (display.containsKey("overdrawPct")) displayConfig.overdrawPct = display["overdrawPct"];
         if (display.containsKey("spiMosi")) displayConfig.spiMosi = display["spiMosi"];
         if (display.containsKey("spiMiso")) displayConfig.spiMiso = display["spiMiso"];
         if (display.containsKey("spiClk")) displayConfig.spiClk = display["spiClk"];
@@ -203,6 +216,8 @@ bool ConfigManager::parseJsonConfig(const char* jsonContent) {
         if (storage.containsKey("sdSpiMiso")) storageConfig.sdSpiMiso = storage["sdSpiMiso"];
         if (storage.containsKey("sdSpiClk")) storageConfig.sdSpiClk = storage["sdSpiClk"];
         if (storage.containsKey("sdSpiCs")) storageConfig.sdSpiCs = storage["sdSpiCs"];
+        if (storage.containsKey("cacheKB")) storageConfig.cacheKB = storage["cacheKB"];
+        if (storage.containsKey("readAheadKB")) storageConfig.readAheadKB = storage["readAheadKB"];
     }
     
     if (doc.containsKey("system")) {
@@ -214,6 +229,9 @@ bool ConfigManager::parseJsonConfig(const char* jsonContent) {
         if (system.containsKey("logLevel"))
             strncpy(systemConfig.logLevel, system["logLevel"], sizeof(systemConfig.logLevel) - 1);
         if (system.containsKey("idleTimeoutSec")) systemConfig.idleTimeoutSec = system["idleTimeoutSec"];
+        if (system.containsKey("glyphCacheSize")) systemConfig.glyphCacheSize = system["glyphCacheSize"];
+        if (system.containsKey("glyphProfile")) systemConfig.glyphProfile = system["glyphProfile"];
+        if (system.containsKey("uiBench")) systemConfig.uiBench = system["uiBench"];
         if (system.containsKey("wifiAutoConnect")) systemConfig.wifiAutoConnect = system["wifiAutoConnect"];
         if (system.containsKey("btEnabled")) systemConfig.btEnabled = system["btEnabled"];
     }
@@ -259,6 +277,7 @@ void ConfigManager::saveDisplayToNVS() {
     preferences.putUShort("height", displayConfig.height);
     preferences.putUChar("colorDepth", displayConfig.colorDepth);
     preferences.putUShort("vdbSize", displayConfig.vdbBufferSizeKB);
+    preferences.putUChar("overdraw", displayConfig.overdrawPct);
     preferences.putChar("spiMosi", displayConfig.spiMosi);
     preferences.putChar("spiMiso", displayConfig.spiMiso);
     preferences.putChar("spiClk", displayConfig.spiClk);
@@ -296,6 +315,8 @@ void ConfigManager::saveStorageToNVS() {
     preferences.putChar("sdMiso", storageConfig.sdSpiMiso);
     preferences.putChar("sdClk", storageConfig.sdSpiClk);
     preferences.putChar("sdCs", storageConfig.sdSpiCs);
+    preferences.putUShort("cacheKB", storageConfig.cacheKB);
+    preferences.putUChar("readAhead", storageConfig.readAheadKB);
     preferences.end();
 }
 
@@ -305,6 +326,9 @@ void ConfigManager::saveSystemToNVS() {
     preferences.putString("font", systemConfig.defaultFont);
     preferences.putString("logLevel", systemConfig.logLevel);
     preferences.putUShort("idleTimeout", systemConfig.idleTimeoutSec);
+    preferences.putUShort("glyphCache", systemConfig.glyphCacheSize);
+    preferences.putBool("glyphProf", systemConfig.glyphProfile);
+    preferences.putBool("uiBench", systemConfig.uiBench);
     preferences.putBool("wifiAuto", systemConfig.wifiAutoConnect);
     preferences.putBool("btEnabled", systemConfig.btEnabled);
     preferences.end();
@@ -335,6 +359,7 @@ int ConfigManager::getInt(const char* section, const char* key) {
         if (keyStr == "height") return displayConfig.height;
         if (keyStr == "colorDepth") return displayConfig.colorDepth;
         if (keyStr == "vdbBufferSizeKB") return displayConfig.vdbBufferSizeKB;
+        if (keyStr == "overdrawPct") return displayConfig.overdrawPct;
         if (keyStr == "spiMosi") return displayConfig.spiMosi;
         if (keyStr == "spiMiso") return displayConfig.spiMiso;
         if (keyStr == "spiClk") return displayConfig.spiClk;
@@ -357,11 +382,16 @@ int ConfigManager::getInt(const char* section, const char* key) {
         if (keyStr == "sdSpiMiso") return storageConfig.sdSpiMiso;
         if (keyStr == "sdSpiClk") return storageConfig.sdSpiClk;
         if (keyStr == "sdSpiCs") return storageConfig.sdSpiCs;
+        if (keyStr == "cacheKB") return storageConfig.cacheKB;
+        if (keyStr == "readAheadKB") return storageConfig.readAheadKB;
     }
     else if (sectionStr == "system") {
         if (keyStr == "idleTimeoutSec") return systemConfig.idleTimeoutSec;
+        if (keyStr == "glyphCacheSize") return systemConfig.glyphCacheSize;
         if (keyStr == "wifiAutoConnect") return systemConfig.wifiAutoConnect ? 1 : 0;
         if (keyStr == "btEnabled") return systemConfig.btEnabled ? 1 : 0;
+        if (keyStr == "glyphProfile") return systemConfig.glyphProfile ? 1 : 0;
+        if (keyStr == "uiBench") return systemConfig.uiBench ? 1 : 0;
     }
     
     return 0;
@@ -413,6 +443,8 @@ bool ConfigManager::getBool(const char* section, const char* key) {
     else if (sectionStr == "system") {
         if (keyStr == "wifiAutoConnect") return systemConfig.wifiAutoConnect;
         if (keyStr == "btEnabled") return systemConfig.btEnabled;
+        if (keyStr == "glyphProfile") return systemConfig.glyphProfile;
+        if (keyStr == "uiBench") return systemConfig.uiBench;
     }
     
     return false;
@@ -427,6 +459,7 @@ void ConfigManager::setInt(const char* section, const char* key, int value) {
         else if (keyStr == "height") displayConfig.height = value;
         else if (keyStr == "colorDepth") displayConfig.colorDepth = value;
         else if (keyStr == "vdbBufferSizeKB") displayConfig.vdbBufferSizeKB = value;
+        else if (keyStr == "overdrawPct") displayConfig.overdrawPct = value;
         else if (keyStr == "spiMosi") displayConfig.spiMosi = value;
         else if (keyStr == "spiMiso") displayConfig.spiMiso = value;
         else if (keyStr == "spiClk") displayConfig.spiClk = value;
@@ -449,11 +482,16 @@ void ConfigManager::setInt(const char* section, const char* key, int value) {
         else if (keyStr == "sdSpiMiso") storageConfig.sdSpiMiso = value;
         else if (keyStr == "sdSpiClk") storageConfig.sdSpiClk = value;
         else if (keyStr == "sdSpiCs") storageConfig.sdSpiCs = value;
+        else if (keyStr == "cacheKB") storageConfig.cacheKB = value;
+        else if (keyStr == "readAheadKB") storageConfig.readAheadKB = value;
     }
     else if (sectionStr == "system") {
         if (keyStr == "idleTimeoutSec") systemConfig.idleTimeoutSec = value;
+        else if (keyStr == "glyphCacheSize") systemConfig.glyphCacheSize = value;
         else if (keyStr == "wifiAutoConnect") systemConfig.wifiAutoConnect = (value != 0);
         else if (keyStr == "btEnabled") systemConfig.btEnabled = (value != 0);
+        else if (keyStr == "glyphProfile") systemConfig.glyphProfile = (value != 0);
+        else if (keyStr == "uiBench") systemConfig.uiBench = (value != 0);
     }
 }
 
@@ -505,6 +543,8 @@ void ConfigManager::setBool(const char* section, const char* key, bool value) {
     else if (sectionStr == "system") {
         if (keyStr == "wifiAutoConnect") systemConfig.wifiAutoConnect = value;
         else if (keyStr == "btEnabled") systemConfig.btEnabled = value;
+        else if (keyStr == "glyphProfile") systemConfig.glyphProfile = value;
+        else if (keyStr == "uiBench") systemConfig.uiBench = value;
     }
 }
 
@@ -517,6 +557,7 @@ void ConfigManager::printConfig() {
     Serial.printf("  Resolution: %d x %d\n", displayConfig.width, displayConfig.height);
     Serial.printf("  Color Depth: %d bits\n", displayConfig.colorDepth);
     Serial.printf("  VDB Buffer Size: %d KB\n", displayConfig.vdbBufferSizeKB);
+    Serial.printf("  Overdraw Budget: %d%%\n", displayConfig.overdrawPct);
     Serial.printf("  SPI Pins: MOSI=%d, MISO=%d, CLK=%d, CS=%d\n", 
                   displayConfig.spiMosi, displayConfig.spiMiso, displayConfig.spiClk, displayConfig.spiCs);
     Serial.printf("  Control Pins: DC=%d, RST=%d, BL=%d\n", 
@@ -539,12 +580,17 @@ void ConfigManager::printConfig() {
     Serial.printf("  SD SPI Pins: MOSI=%d, MISO=%d, CLK=%d, CS=%d\n",
                   storageConfig.sdSpiMosi, storageConfig.sdSpiMiso, 
                   storageConfig.sdSpiClk, storageConfig.sdSpiCs);
+    Serial.printf("  Resource Cache: %d KB\n", storageConfig.cacheKB);
+    Serial.printf("  Read-ahead: %d KB\n", storageConfig.readAheadKB);
     
     Serial.println("\n[System]");
     Serial.printf("  Default Theme: %s\n", systemConfig.defaultTheme);
     Serial.printf("  Default Font: %s\n", systemConfig.defaultFont);
     Serial.printf("  Log Level: %s\n", systemConfig.logLevel);
     Serial.printf("  Idle Timeout: %d seconds\n", systemConfig.idleTimeoutSec);
+    Serial.printf("  Glyph Cache: %d glyphs\n", systemConfig.glyphCacheSize);
+    Serial.printf("  Glyph Profile: %s\n", systemConfig.glyphProfile ? "Yes" : "No");
+    Serial.printf("  UI Benchmark: %s\n", systemConfig.uiBench ? "Yes" : "No");
     Serial.printf("  WiFi Auto Connect: %s\n", systemConfig.wifiAutoConnect ? "Yes" : "No");
     Serial.printf("  Bluetooth Enabled: %s\n", systemConfig.btEnabled ? "Yes" : "No");
     
@@ -14,6 +14,7 @@ struct DisplayConfig {
     uint16_t height;
     uint8_t colorDepth;
     uint16_t vdbBufferSizeKB;
+    uint8_t overdrawPct;
     int8_t spiMosi;
     int8_t spiMiso;
     int8_t spiClk;
@@ -41,6 +42,8 @@ struct StorageConfig {
     int8_t sdSpiMiso;
     int8_t sdSpiClk;
     int8_t sdSpiCs;
+    uint16_t cacheKB;
+    uint8_t readAheadKB;
 };
 
 struct SystemConfig {
@@ -48,6 +51,9 @@ struct SystemConfig {
     char defaultFont[64];
     char logLevel[16];
     uint16_t idleTimeoutSec;
+    uint16_t glyphCacheSize;
+    bool glyphProfile;
+    bool uiBench;
     bool wifiAutoConnect;
     bool btEnabled;
 };
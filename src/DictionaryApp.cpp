@@ -2,6 +2,7 @@
 #include "Storage.h"
 #include "LvZhFont.h"
 #include "BSP.h"
+#include "IOScheduler.h"
 #include <SD.h>
 
 DictionaryApp::DictionaryApp() : BaseApp("Dictionary") {
@@ -81,9 +82,8 @@ void DictionaryApp::destroyUI() {
         keyboard = nullptr;
     }
     
-    if (dictFile) {
-        dictFile.close();
-    }
+    SdIO.run(close_dict_io, this, IO_PRIO_NORMAL, DICT_FILE_PATH);
+    dictLoaded = false;
     
     clearSearchResults();
 }
@@ -293,28 +293,54 @@ void DictionaryApp::showDetailPage(int index) {
     lv_obj_move_foreground(detailPage);
 }
 
+// Runs on the IO task, which owns the card. dictFile is only ever touched
+// there, so it can stay open between searches.
+int DictionaryApp::open_dict_io(void* ctx) {
+    DictionaryApp* app = (DictionaryApp*)ctx;
+    if (!SD.exists(DICT_FILE_PATH)) {
+        return -1;
+    }
+    app->dictFile = SD.open(DICT_FILE_PATH);
+    if (!app->dictFile) {
+        return -2;
+    }
+    app->dictFileSize = app->dictFile.size();
+    return 0;
+}
+
+int DictionaryApp::close_dict_io(void* ctx) {
+    DictionaryApp* app = (DictionaryApp*)ctx;
+    if (app->dictFile) {
+        app->dictFile.close();
+    }
+    return 0;
+}
+
 void DictionaryApp::loadDictionaryIndex() {
     Serial.println("[DictionaryApp] Loading dictionary...");
     
-    if (!SD.exists("/Dictionary/ecdict.csv")) {
+    int result = SdIO.run(open_dict_io, this, IO_PRIO_INTERACTIVE, DICT_FILE_PATH);
+    if (result == -1) {
         Serial.println("[DictionaryApp] Dictionary file not found");
         return;
     }
-    
-    dictFile = SD.open("/Dictionary/ecdict.csv");
-    if (!dictFile) {
+    if (result < 0) {
         Serial.println("[DictionaryApp] Failed to open dictionary");
         return;
     }
     
-    dictFileSize = dictFile.size();
     dictLoaded = true;
     
     Serial.printf("[DictionaryApp] Dictionary loaded, size: %u bytes\n", dictFileSize);
 }
 
+int DictionaryApp::search_io(void* ctx) {
+    dict_search_t* search = (dict_search_t*)ctx;
+    return search->app->scanDictionary(search) ? 1 : 0;
+}
+
 bool DictionaryApp::searchDictionary(const char* keyword) {
-    if (!dictLoaded || !dictFile) {
+    if (!dictLoaded) {
         Serial.println("[DictionaryApp] Dictionary not loaded");
         return false;
     }
@@ -326,174 +352,149 @@ bool DictionaryApp::searchDictionary(const char* keyword) {
     
     Serial.printf("[DictionaryApp] Searching for: %s\n", keyword);
     
-    char firstChar = tolower(keyword[0]);
-    int matchCount = 0;
-    int linesChecked = 0;
-    int maxLinesToCheck = 50000;
+    dict_search_t search = {};
+    search.app = this;
+    search.keyword = keyword;
+    search.len = len;
+    search.linesChecked = -1;   // not started
     unsigned long startTime = millis();
     
-    if (firstChar >= 'a' && firstChar <= 'z') {
-        int letterIndex = firstChar - 'a';
-        unsigned long startPos = (dictFileSize * letterIndex) / 30;
-        unsigned long endPos = dictFileSize;
-        
-        Serial.printf("[DictionaryApp] Trying optimized search at byte %lu\n", startPos);
-        
-        dictFile.seek(startPos);
-        if (startPos > 0) {
-            dictFile.readStringUntil('\n');
-        }
-        
-        while (dictFile.available() && matchCount < DICT_MAX_RESULTS && linesChecked < maxLinesToCheck) {
-            unsigned long currentPos = dictFile.position();
-            
-            if (currentPos > endPos && matchCount > 0) {
-                break;
-            }
-            
-            String line = dictFile.readStringUntil('\n');
-            linesChecked++;
-            
-            int commaPos = line.indexOf(',');
-            if (commaPos <= 0) continue;
-            
-            String word = line.substring(0, commaPos);
+    // The first chunk is an interactive request, ahead of whatever
+    // background writes other apps have queued. Later chunks take the
+    // background deadline, so everything already queued runs before them.
+    io_request_t req = {};
+    req.op = IO_OP_EXEC;
+    req.prio = IO_PRIO_INTERACTIVE;
+    req.path = DICT_FILE_PATH;
+    req.fn = search_io;
+    req.ctx = &search;
+    int chunks = 0;
+    while (SdIO.call(req) == 0) {
+        req.deadlineMs = IO_BUDGET_BACKGROUND_MS;
+        chunks++;
+    }
+    
+    unsigned long searchTime = millis() - startTime;
+    Serial.printf("[DictionaryApp] Found %d results (checked %d lines in %lu ms, %d chunks)\n", 
+                  search.matchCount, search.linesChecked, searchTime, chunks + 1);
+    return search.matchCount > 0;
+}
+
+// Adds the CSV line as a result if its word starts with the keyword
+bool DictionaryApp::matchLine(const String& line, const char* keyword, int len) {
+    int commaPos = line.indexOf(',');
+    if (commaPos <= 0) return false;
+    
+    String word = line.substring(0, commaPos);
+    
+    if (word.length() < len || strncasecmp(word.c_str(), keyword, len) != 0) {
+        return false;
+    }
+    
+    dict_entry_t entry;
+    strncpy(entry.word, word.c_str(), DICT_WORD_MAX_LEN - 1);
+    entry.word[DICT_WORD_MAX_LEN - 1] = '\0';
+    entry.phonetic[0] = '\0';
+    entry.translation[0] = '\0';
+    entry.definition[0] = '\0';
+    entry.pos[0] = '\0';
+    
+    int pos1 = commaPos + 1;
+    int pos2 = line.indexOf(',', pos1);
+    if (pos2 > pos1) {
+        String phonetic = line.substring(pos1, pos2);
+        strncpy(entry.phonetic, phonetic.c_str(), DICT_PHONETIC_MAX_LEN - 1);
+        entry.phonetic[DICT_PHONETIC_MAX_LEN - 1] = '\0';
+    }
+    
+    pos1 = pos2 + 1;
+    pos2 = line.indexOf(',', pos1);
+    
+    if (pos2 > pos1) {
+        String definition = line.substring(pos1, pos2);
+        strncpy(entry.definition, definition.c_str(), DICT_DEF_MAX_LEN - 1);
+        entry.definition[DICT_DEF_MAX_LEN - 1] = '\0';
+    }
+    
+    pos1 = pos2 + 1;
+    pos2 = line.indexOf(',', pos1);
+    
+    if (pos2 > pos1) {
+        String translation = line.substring(pos1, pos2);
+        strncpy(entry.translation, translation.c_str(), DICT_TRANS_MAX_LEN - 1);
+        entry.translation[DICT_TRANS_MAX_LEN - 1] = '\0';
+    }
+    
+    pos1 = pos2 + 1;
+    pos2 = line.indexOf(',', pos1);
+    
+    if (pos2 > pos1) {
+        String pos = line.substring(pos1, pos2);
+        strncpy(entry.pos, pos.c_str(), DICT_POS_MAX_LEN - 1);
+        entry.pos[DICT_POS_MAX_LEN - 1] = '\0';
+    }
+    
+    searchResults.push_back(entry);
+    return true;
+}
+
+// Scans up to DICT_SCAN_CHUNK_LINES lines on the IO task, carrying on
+// from where the previous chunk of the same search stopped. True once the
+// search is finished.
+bool DictionaryApp::scanDictionary(dict_search_t* search) {
+    if (!dictFile) {
+        return true;
+    }
+    
+    if (search->linesChecked < 0) {
+        search->linesChecked = 0;
+        char firstChar = tolower(search->keyword[0]);
+        if (firstChar >= 'a' && firstChar <= 'z') {
+            unsigned long startPos = (dictFileSize * (firstChar - 'a')) / 30;
+            Serial.printf("[DictionaryApp] Trying optimized search at byte %lu\n", startPos);
             
-            if (word.length() >= len && 
-                strncasecmp(word.c_str(), keyword, len) == 0) {
-                
-                dict_entry_t entry;
-                strncpy(entry.word, word.c_str(), DICT_WORD_MAX_LEN - 1);
-                entry.word[DICT_WORD_MAX_LEN - 1] = '\0';
-                entry.phonetic[0] = '\0';
-                entry.translation[0] = '\0';
-                entry.definition[0] = '\0';
-                entry.pos[0] = '\0';
-                
-                int pos1 = commaPos + 1;
-                int pos2 = line.indexOf(',', pos1);
-                if (pos2 > pos1) {
-                    String phonetic = line.substring(pos1, pos2);
-                    strncpy(entry.phonetic, phonetic.c_str(), DICT_PHONETIC_MAX_LEN - 1);
-                    entry.phonetic[DICT_PHONETIC_MAX_LEN - 1] = '\0';
-                }
-                
-                pos1 = pos2 + 1;
-                pos2 = line.indexOf(',', pos1);
-                
-                if (pos2 > pos1) {
-                    String definition = line.substring(pos1, pos2);
-                    strncpy(entry.definition, definition.c_str(), DICT_DEF_MAX_LEN - 1);
-                    entry.definition[DICT_DEF_MAX_LEN - 1] = '\0';
-                }
-                
-                pos1 = pos2 + 1;
-                pos2 = line.indexOf(',', pos1);
-                
-                if (pos2 > pos1) {
-                    String translation = line.substring(pos1, pos2);
-                    strncpy(entry.translation, translation.c_str(), DICT_TRANS_MAX_LEN - 1);
-                    entry.translation[DICT_TRANS_MAX_LEN - 1] = '\0';
-                }
-                
-                pos1 = pos2 + 1;
-                pos2 = line.indexOf(',', pos1);
-                
-                if (pos2 > pos1) {
-                    String pos = line.substring(pos1, pos2);
-                    strncpy(entry.pos, pos.c_str(), DICT_POS_MAX_LEN - 1);
-                    entry.pos[DICT_POS_MAX_LEN - 1] = '\0';
-                }
-                
-                searchResults.push_back(entry);
-                matchCount++;
+            search->optimized = true;
+            search->maxLinesToCheck = 50000;
+            dictFile.seek(startPos);
+            if (startPos > 0) {
+                dictFile.readStringUntil('\n');
             }
+        } else {
+            search->maxLinesToCheck = 100000;
+            dictFile.seek(0);
         }
-        
-        if (matchCount > 0) {
-            unsigned long searchTime = millis() - startTime;
-            Serial.printf("[DictionaryApp] Found %d results (checked %d lines in %lu ms)\n", 
-                          matchCount, linesChecked, searchTime);
-            return true;
-        }
-        
-        Serial.println("[DictionaryApp] Optimized search failed, trying from start...");
     }
     
-    matchCount = 0;
-    linesChecked = 0;
-    maxLinesToCheck = 100000;
-    
-    dictFile.seek(0);
-    
-    while (dictFile.available() && matchCount < DICT_MAX_RESULTS && linesChecked < maxLinesToCheck) {
+    int chunkEnd = search->linesChecked + DICT_SCAN_CHUNK_LINES;
+    while (dictFile.available() && search->matchCount < DICT_MAX_RESULTS &&
+           search->linesChecked < search->maxLinesToCheck && search->linesChecked < chunkEnd) {
         String line = dictFile.readStringUntil('\n');
-        linesChecked++;
+        search->linesChecked++;
         
-        if (linesChecked % 10000 == 0) {
-            Serial.printf("[DictionaryApp] Progress: %d lines checked\n", linesChecked);
+        if (!search->optimized && search->linesChecked % 10000 == 0) {
+            Serial.printf("[DictionaryApp] Progress: %d lines checked\n", search->linesChecked);
         }
         
-        int commaPos = line.indexOf(',');
-        if (commaPos <= 0) continue;
-        
-        String word = line.substring(0, commaPos);
-        
-        if (word.length() >= len && 
-            strncasecmp(word.c_str(), keyword, len) == 0) {
-            
-            dict_entry_t entry;
-            strncpy(entry.word, word.c_str(), DICT_WORD_MAX_LEN - 1);
-            entry.word[DICT_WORD_MAX_LEN - 1] = '\0';
-            entry.phonetic[0] = '\0';
-            entry.translation[0] = '\0';
-            entry.definition[0] = '\0';
-            entry.pos[0] = '\0';
-            
-            int pos1 = commaPos + 1;
-            int pos2 = line.indexOf(',', pos1);
-            if (pos2 > pos1) {
-                String phonetic = line.substring(pos1, pos2);
-                strncpy(entry.phonetic, phonetic.c_str(), DICT_PHONETIC_MAX_LEN - 1);
-                entry.phonetic[DICT_PHONETIC_MAX_LEN - 1] = '\0';
-            }
-            
-            pos1 = pos2 + 1;
-            pos2 = line.indexOf(',', pos1);
-            
-            if (pos2 > pos1) {
-                String definition = line.substring(pos1, pos2);
-                strncpy(entry.definition, definition.c_str(), DICT_DEF_MAX_LEN - 1);
-                entry.definition[DICT_DEF_MAX_LEN - 1] = '\0';
-            }
-            
-            pos1 = pos2 + 1;
-            pos2 = line.indexOf(',', pos1);
-            
-            if (pos2 > pos1) {
-                String translation = line.substring(pos1, pos2);
-                strncpy(entry.translation, translation.c_str(), DICT_TRANS_MAX_LEN - 1);
-                entry.translation[DICT_TRANS_MAX_LEN - 1] = '\0';
-            }
-            
-            pos1 = pos2 + 1;
-            pos2 = line.indexOf(',', pos1);
-            
-            if (pos2 > pos1) {
-                String pos = line.substring(pos1, pos2);
-                strncpy(entry.pos, pos.c_str(), DICT_POS_MAX_LEN - 1);
-                entry.pos[DICT_POS_MAX_LEN - 1] = '\0';
-            }
-            
-            searchResults.push_back(entry);
-            matchCount++;
+        if (matchLine(line, search->keyword, search->len)) {
+            search->matchCount++;
         }
     }
     
-    unsigned long searchTime = millis() - startTime;
-    Serial.printf("[DictionaryApp] Found %d results (checked %d lines in %lu ms)\n", 
-                  matchCount, linesChecked, searchTime);
-    return matchCount > 0;
+    bool exhausted = !dictFile.available() || search->matchCount >= DICT_MAX_RESULTS ||
+                     search->linesChecked >= search->maxLinesToCheck;
+    if (!exhausted) {
+        return false;
+    }
+    
+    if (search->optimized && search->matchCount == 0) {
+        Serial.println("[DictionaryApp] Optimized search failed, trying from start...");
+        search->optimized = false;
+        search->linesChecked = 0;
+        search->maxLinesToCheck = 100000;
+        dictFile.seek(0);
+        return false;
+    }
+    return true;
 }
 
 void DictionaryApp::performSearch() {
@@ -564,6 +565,7 @@ void DictionaryApp::displayDetail(int index) {
         lv_label_set_text(detailPos, "");
     }
     
+    LvZhFontMgr.prefetch(entry.translation);
     lv_label_set_text(detailTranslation, entry.translation);
     lv_label_set_text(detailDefinition, entry.definition);
 }
@@ -607,42 +609,62 @@ void DictionaryApp::updateHotWordsButtons() {
 void DictionaryApp::saveState() {
     if (!sdCardAvailable) return;
     
-    File cacheFile = SD.open(DICT_CACHE_PATH, FILE_WRITE);
-    if (!cacheFile) {
-        Serial.println("[DictionaryApp] Failed to save cache");
-        return;
-    }
+    String cache;
+    char line[DICT_WORD_MAX_LEN + 32];
     
-    cacheFile.printf("last_search=%s\n", lastSearch);
-    cacheFile.printf("history_count=%d\n", (int)searchHistory.size());
+    cache += "last_search=";
+    cache += lastSearch;
+    cache += "\n";
+    snprintf(line, sizeof(line), "history_count=%d\n", (int)searchHistory.size());
+    cache += line;
     
     for (size_t i = 0; i < searchHistory.size(); i++) {
-        cacheFile.printf("history_%d=%s\n", (int)i, searchHistory[i].c_str());
+        snprintf(line, sizeof(line), "history_%d=", (int)i);
+        cache += line;
+        cache += searchHistory[i];
+        cache += "\n";
     }
     
-    cacheFile.printf("hot_count=%d\n", (int)hotWords.size());
+    snprintf(line, sizeof(line), "hot_count=%d\n", (int)hotWords.size());
+    cache += line;
     
     for (size_t i = 0; i < hotWords.size(); i++) {
-        cacheFile.printf("hot_%d=%s,%d\n", (int)i, hotWords[i].word, hotWords[i].frequency);
+        snprintf(line, sizeof(line), "hot_%d=%s,%d\n", (int)i, hotWords[i].word, hotWords[i].frequency);
+        cache += line;
     }
     
-    cacheFile.close();
+    if (!SdIO.write(DICT_CACHE_PATH, cache.c_str(), cache.length(), IO_PRIO_BACKGROUND)) {
+        Serial.println("[DictionaryApp] Failed to save cache");
+        return;
+    }
     Serial.println("[DictionaryApp] Cache saved");
 }
 
+// Runs on the IO task while the UI task waits in loadState()
+int DictionaryApp::load_cache_io(void* ctx) {
+    File cacheFile = SD.open(DICT_CACHE_PATH);
+    if (!cacheFile) {
+        return -1;
+    }
+    ((DictionaryApp*)ctx)->readCache(cacheFile);
+    cacheFile.close();
+    return 0;
+}
+
 bool DictionaryApp::loadState() {
     if (!sdCardAvailable) return false;
     
-    if (!SD.exists(DICT_CACHE_PATH)) {
+    // Queued behind a save still pending for the same file
+    if (SdIO.run(load_cache_io, this, IO_PRIO_INTERACTIVE, DICT_CACHE_PATH) < 0) {
         Serial.println("[DictionaryApp] No cache file found");
         return false;
     }
     
-    File cacheFile = SD.open(DICT_CACHE_PATH);
-    if (!cacheFile) {
-        return false;
-    }
-    
+    Serial.println("[DictionaryApp] Cache loaded");
+    return true;
+}
+
+void DictionaryApp::readCache(fs::File& cacheFile) {
     int historyCount = 0;
     int hotCount = 0;
     char savedLastSearch[DICT_INPUT_MAX_LEN] = "";
@@ -685,15 +707,10 @@ bool DictionaryApp::loadState() {
         }
     }
     
-    cacheFile.close();
-    
     if (strlen(savedLastSearch) > 0) {
         strncpy(lastSearch, savedLastSearch, DICT_INPUT_MAX_LEN - 1);
         lastSearch[DICT_INPUT_MAX_LEN - 1] = '\0';
     }
-    
-    Serial.println("[DictionaryApp] Cache loaded");
-    return true;
 }
 
 void DictionaryApp::clearSearchResults() {
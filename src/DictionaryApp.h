@@ -13,7 +13,9 @@
 #define DICT_INPUT_MAX_LEN     64
 #define DICT_MAX_RESULTS       20
 #define DICT_MAX_HISTORY      10
+#define DICT_FILE_PATH         "/Dictionary/ecdict.csv"
 #define DICT_CACHE_PATH        "/Dictionary/.cache"
+#define DICT_SCAN_CHUNK_LINES  500     // lines per IO request; other apps' IO runs in between
 
 typedef enum {
     DICT_PAGE_SEARCH = 0,
@@ -34,6 +36,19 @@ typedef struct {
     int frequency;
 } hot_word_t;
 
+class DictionaryApp;
+
+// A search in progress, carried from one scan chunk to the next
+typedef struct {
+    DictionaryApp* app;
+    const char* keyword;
+    int len;
+    bool optimized;             // started at the estimated offset of the first letter
+    int matchCount;
+    int linesChecked;           // -1 until the first chunk
+    int maxLinesToCheck;
+} dict_search_t;
+
 class DictionaryApp : public BaseApp {
 private:
     lv_obj_t* searchPage;
@@ -90,7 +105,12 @@ private:
     void showDetailPage(int index);
     
     void loadDictionaryIndex();
+    static int open_dict_io(void* ctx);
+    static int close_dict_io(void* ctx);
     bool searchDictionary(const char* keyword);
+    bool scanDictionary(dict_search_t* search);
+    bool matchLine(const String& line, const char* keyword, int len);
+    static int search_io(void* ctx);
     void performSearch();
     
     void displayResults();
@@ -101,6 +121,8 @@ private:
     
     void saveState() override;
     bool loadState() override;
+    void readCache(fs::File& cacheFile);
+    static int load_cache_io(void* ctx);
     
     void clearSearchResults();
     void clearPages();
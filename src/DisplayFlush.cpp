@@ -0,0 +1,189 @@
+#include "DisplayFlush.h"
+
+uint32_t flush_buffer_lines(uint32_t totalKB, uint32_t lineBytes, uint32_t maxLines,
+                            uint32_t freeBytes, uint32_t largestBlock, int* buffers) {
+    uint32_t lines = totalKB * 1024 / *buffers / lineBytes;
+
+    uint32_t budget = freeBytes > VDB_HEAP_RESERVE ? freeBytes - VDB_HEAP_RESERVE : 0;
+    uint32_t perBuffer = budget / *buffers;
+    uint32_t fitLines = (perBuffer < largestBlock ? perBuffer : largestBlock) / lineBytes;
+
+    if (*buffers == 2 && fitLines < VDB_MIN_LINES) {
+        *buffers = 1;
+        fitLines = (budget < largestBlock ? budget : largestBlock) / lineBytes;
+    }
+    if (lines > fitLines) lines = fitLines;
+    if (lines > maxLines) lines = maxLines;
+    if (lines < VDB_MIN_LINES) lines = VDB_MIN_LINES;
+    return lines;
+}
+
+static inline uint32_t areaSize(const flush_area_t& a) {
+    return (uint32_t)(a.x2 - a.x1 + 1) * (uint32_t)(a.y2 - a.y1 + 1);
+}
+
+static inline int16_t min16(int16_t a, int16_t b) { return a < b ? a : b; }
+static inline int16_t max16(int16_t a, int16_t b) { return a > b ? a : b; }
+static inline uint32_t max32(uint32_t a, uint32_t b) { return a > b ? a : b; }
+
+// Greedy pairwise merge over the areas LVGL has not joined. covered[]
+// tracks the dirty pixels inside each merged box (overlaps counted once,
+// approximately), so overdraw does not compound across merges. The union
+// is stored in the later slot: LVGL picked the last area to draw before
+// calling render_start_cb, and that slot has to stay live.
+uint16_t flush_merge_areas(flush_area_t* areas, uint8_t* joined, uint16_t count, uint32_t budgetPct,
+                           uint32_t* dirtyPx, uint32_t* overdrawPx) {
+    uint32_t covered[FLUSH_MAX_AREAS];
+    uint32_t dirty = 0;
+    if (count > FLUSH_MAX_AREAS) {
+        count = FLUSH_MAX_AREAS;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        covered[i] = joined[i] ? 0 : areaSize(areas[i]);
+        dirty += covered[i];
+    }
+    
+    uint16_t merges = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint16_t i = 0; i < count && !changed; i++) {
+            if (joined[i]) continue;
+            for (uint16_t j = i + 1; j < count; j++) {
+                if (joined[j]) continue;
+                
+                const flush_area_t& a = areas[i];
+                const flush_area_t& b = areas[j];
+                flush_area_t both = { min16(a.x1, b.x1), min16(a.y1, b.y1), max16(a.x2, b.x2), max16(a.y2, b.y2) };
+                flush_area_t common = { max16(a.x1, b.x1), max16(a.y1, b.y1), min16(a.x2, b.x2), min16(a.y2, b.y2) };
+                uint32_t overlap = common.x1 <= common.x2 && common.y1 <= common.y2 ? areaSize(common) : 0;
+                uint32_t cover = covered[i] + covered[j];
+                cover = overlap < cover ? cover - overlap : 0;
+                cover = max32(cover, max32(covered[i], covered[j]));
+                
+                if ((uint64_t)areaSize(both) * 100 > (uint64_t)cover * (100 + budgetPct)) {
+                    continue;
+                }
+                areas[j] = both;
+                covered[j] = cover;
+                joined[i] = 1;
+                merges++;
+                changed = true;
+                break;
+            }
+        }
+    }
+    
+    uint32_t drawn = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (!joined[i]) {
+            drawn += areaSize(areas[i]);
+        }
+    }
+    *dirtyPx = dirty;
+    *overdrawPx = drawn > dirty ? drawn - dirty : 0;
+    return merges;
+}
+
+static inline uint32_t hashRow(const uint16_t* px, uint32_t w) {
+    uint32_t h = 2166136261UL;
+    for (uint32_t i = 0; i < w; i++) {
+        h = (h ^ px[i]) * 16777619UL;
+    }
+    return h;
+}
+
+FlushFilter::FlushFilter(flush_row_t* rows, uint16_t rowCount)
+    : rows(rows), rowCount(rowCount), scanFlushes(0), scanBytes(0), scanSkipped(0), scanBackoff(0) {
+    invalidate();
+}
+
+void FlushFilter::invalidate() {
+    for (uint16_t i = 0; i < rowCount; i++) {
+        rows[i].x1 = -1;
+    }
+}
+
+// Scanning pays for itself once skipped bytes exceed scanned / COST_DIV.
+// After a window where it did not, flushes go out unscanned for a while.
+void FlushFilter::accountScan(uint32_t scanned, uint32_t skipped) {
+    scanBytes += scanned;
+    scanSkipped += skipped;
+    if (++scanFlushes < FLUSH_SCAN_WINDOW) {
+        return;
+    }
+    if (scanSkipped * FLUSH_SCAN_COST_DIV < scanBytes) {
+        scanBackoff = FLUSH_SCAN_BACKOFF;
+    }
+    scanFlushes = 0;
+    scanBytes = 0;
+    scanSkipped = 0;
+}
+
+uint32_t FlushFilter::flush(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t* px, flush_push_t push) {
+    uint32_t w = x2 - x1 + 1;
+    uint32_t h = y2 - y1 + 1;
+    uint32_t sent = 0;
+    
+    if (scanBackoff > 0) {
+        scanBackoff--;
+        for (uint32_t r = 0; r < h; r++) {
+            rows[y1 + r].x1 = -1;
+        }
+        push(x1, y1, w, h, px);
+        return h;
+    }
+    
+    int runStart = -1;
+    int runEnd = -1;
+    for (int r = 0; r < (int)h; r++) {
+        uint32_t hash = hashRow(px + r * w, w);
+        flush_row_t& row = rows[y1 + r];
+        bool same = row.x1 == x1 && row.x2 == x2 && row.hash == hash;
+        row.x1 = x1;
+        row.x2 = x2;
+        row.hash = hash;
+        if (same) {
+            continue;
+        }
+        
+        if (runStart >= 0 && (r - runEnd - 1) * w * sizeof(uint16_t) >= FLUSH_SPLIT_MIN_BYTES) {
+            push(x1, y1 + runStart, w, runEnd - runStart + 1, px + runStart * w);
+            sent += runEnd - runStart + 1;
+            runStart = -1;
+        }
+        if (runStart < 0) {
+            runStart = r;
+        }
+        runEnd = r;
+    }
+    if (runStart >= 0) {
+        push(x1, y1 + runStart, w, runEnd - runStart + 1, px + runStart * w);
+        sent += runEnd - runStart + 1;
+    }
+    accountScan(w * h * sizeof(uint16_t), (h - sent) * w * sizeof(uint16_t));
+    return sent;
+}
+
+FlushTracker::FlushTracker(const flush_bus_t* bus) : bus(bus), job(), pending(false) {
+}
+
+void FlushTracker::start(const flush_job_t& j) {
+    job = j;
+    pending = true;
+}
+
+bool FlushTracker::complete(bool wait, flush_job_t* done) {
+    if (!pending) {
+        return false;
+    }
+    if (!wait && bus->busy()) {
+        return false;
+    }
+
+    bus->wait();
+    pending = false;
+    bus->end();
+    *done = job;
+    return true;
+}
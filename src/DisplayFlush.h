@@ -0,0 +1,113 @@
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Display flush logic behind BSP: draw buffer sizing, merging invalid
+// areas, skipping rows the panel already shows, and completion of DMA
+// transfers. Plain C++ with no Arduino headers, so the native test
+// env builds it.
+
+#define VDB_MIN_LINES    10
+#define VDB_HEAP_RESERVE (48 * 1024)
+
+// Lines per draw buffer when totalKB is split over *buffers buffers,
+// bounded by free DMA heap less VDB_HEAP_RESERVE, by the largest free
+// block and by maxLines. Drops to one buffer (*buffers = 1) when two would
+// each be under VDB_MIN_LINES. Never below VDB_MIN_LINES.
+uint32_t flush_buffer_lines(uint32_t totalKB, uint32_t lineBytes, uint32_t maxLines,
+                            uint32_t freeBytes, uint32_t largestBlock, int* buffers);
+
+#define FLUSH_MAX_AREAS  32         // LV_INV_BUF_SIZE
+
+// Inclusive bounds, as lv_area_t
+typedef struct {
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} flush_area_t;
+
+// Merges pairs of areas not yet joined while their union redraws at most
+// budgetPct percent more pixels than are dirty in them. A merged area is
+// marked joined and its union kept in the later slot, so the last slot is
+// never joined. Returns the merges; *dirtyPx gets the dirty pixels before
+// merging, *overdrawPx the extra pixels the remaining areas redraw.
+uint16_t flush_merge_areas(flush_area_t* areas, uint8_t* joined, uint16_t count, uint32_t budgetPct,
+                           uint32_t* dirtyPx, uint32_t* overdrawPx);
+
+// Rows whose bytes are already on the panel are not sent again. Each panel
+// row remembers the span and hash of the last pixels written to it.
+#define FLUSH_SPLIT_MIN_BYTES  256  // smaller gaps are cheaper to resend than a new window
+#define FLUSH_SCAN_COST_DIV    32   // hashing a byte costs < 1/32 of sending it at 20 MHz
+#define FLUSH_SCAN_WINDOW      64   // flushes per cost-model check
+#define FLUSH_SCAN_BACKOFF     256  // flushes sent unscanned after a losing window
+
+typedef struct {
+    int16_t x1;
+    int16_t x2;
+    uint32_t hash;
+} flush_row_t;
+
+// Sends one address window of RGB565 pixels
+typedef void (*flush_push_t)(int16_t x, int16_t y, uint32_t w, uint32_t h, uint16_t* px);
+
+// Not locked; only the LVGL task flushes.
+class FlushFilter {
+private:
+    flush_row_t* rows;
+    uint16_t rowCount;
+    uint32_t scanFlushes;
+    uint32_t scanBytes;
+    uint32_t scanSkipped;
+    uint32_t scanBackoff;
+    
+    void accountScan(uint32_t scanned, uint32_t skipped);
+
+public:
+    // rows holds one entry per panel row
+    FlushFilter(flush_row_t* rows, uint16_t rowCount);
+
+    // Pushes the rows of the area that differ from the panel, joining runs
+    // split by small gaps. Returns the rows pushed.
+    uint32_t flush(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t* px, flush_push_t push);
+    // Forgets the panel contents, e.g. after the panel was cleared directly
+    void invalidate();
+    bool isScanning() const { return scanBackoff == 0; }
+};
+
+// Bus operations for the transfer in flight
+typedef struct {
+    bool (*busy)(void);
+    void (*wait)(void);     // blocks until the transfer is done
+    void (*end)(void);      // ends the SPI transaction
+} flush_bus_t;
+
+typedef struct {
+    void* disp;             // lv_disp_drv_t to release
+    uint32_t startUs;
+    uint32_t pixels;
+    uint16_t windows;
+} flush_job_t;
+
+// One DMA transfer in flight at a time. The flush callback starts it; the
+// LVGL task completes it from wait_cb, or after lv_timer_handler() so the
+// last stripe of a frame is released promptly.
+class FlushTracker {
+private:
+    const flush_bus_t* bus;
+    flush_job_t job;
+    volatile bool pending;
+
+public:
+    FlushTracker(const flush_bus_t* bus);
+
+    void start(const flush_job_t& job);
+    bool isPending() const { return pending; }
+    // Ends the transfer in flight and hands back its job for
+    // lv_disp_flush_ready(). Without wait, false while the bus is busy.
+    bool complete(bool wait, flush_job_t* done);
+};
+
+#endif
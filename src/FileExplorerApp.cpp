@@ -2,6 +2,7 @@
 #include "AppManager.h"
 #include "Storage.h"
 #include "BSP.h"
+#include "IOScheduler.h"
 #include <SD.h>
 #include <SPIFFS.h>
 
@@ -198,10 +199,16 @@ void FileExplorerApp::confirmSelection() {
         Serial.println("[FileExplorer] Using pending_prompt for prompts folder");
     }
     
-    File pendingFile = SD.open(pendingFileName, FILE_WRITE);
-    if (pendingFile) {
-        pendingFile.printf("%s\n", fullPath);
-        pendingFile.close();
+    // Synchronous, since ChatApp reads it back as soon as it is created
+    char pending[MAX_PATH_LENGTH * 2 + 2];
+    io_request_t req = {};
+    req.op = IO_OP_WRITE;
+    req.prio = IO_PRIO_NORMAL;
+    req.path = pendingFileName;
+    req.data = pending;
+    req.len = snprintf(pending, sizeof(pending), "%s\n", fullPath);
+    
+    if (SdIO.call(req) >= 0) {
         Serial.printf("[FileExplorer] Written to %s\n", pendingFileName);
     } else {
         Serial.println("[FileExplorer] Failed to write pending file");
@@ -211,6 +218,26 @@ void FileExplorerApp::confirmSelection() {
     AppMgr.switchToApp("Chat");
 }
 
+// Runs on the IO task for the SD card, so it only fills fileList
+bool FileExplorerApp::list_entry_cb(const char* name, bool isDir, size_t size, void* ctx) {
+    FileExplorerApp* app = (FileExplorerApp*)ctx;
+    file_entry_t entry;
+    
+    const char* displayName = name;
+    const char* lastSlash = strrchr(name, '/');
+    if (lastSlash) {
+        displayName = lastSlash + 1;
+    }
+    
+    strncpy(entry.name, displayName, FILENAME_MAX_LEN - 1);
+    entry.name[FILENAME_MAX_LEN - 1] = '\0';
+    entry.isDirectory = isDir;
+    entry.size = size;
+    
+    app->fileList.push_back(entry);
+    return app->fileList.size() < MAX_FILES_DISPLAY;
+}
+
 void FileExplorerApp::refreshFileList() {
     if (!listFiles) return;
     
@@ -237,33 +264,31 @@ void FileExplorerApp::refreshFileList() {
         driveLetter = 'F';
     }
     
-    File root = fs->open(currentPath);
-    if (!root || !root.isDirectory()) {
+    int listed = -1;
+    if (currentStorage == STORAGE_SD) {
+        // Interactive, so the listing goes ahead of queued background writes
+        listed = SdIO.list(currentPath, list_entry_cb, this, IO_PRIO_INTERACTIVE);
+    } else {
+        File root = fs->open(currentPath);
+        if (root && root.isDirectory()) {
+            listed = 0;
+            File file = root.openNextFile();
+            while (file && list_entry_cb(file.name(), file.isDirectory(), file.size(), this)) {
+                listed++;
+                file = root.openNextFile();
+            }
+            root.close();
+        }
+    }
+    
+    if (listed < 0) {
         lv_list_add_btn(listFiles, LV_SYMBOL_WARNING, "Cannot open directory");
         return;
     }
     
-    File file = root.openNextFile();
     int count = 0;
     
-    while (file && count < MAX_FILES_DISPLAY) {
-        file_entry_t entry;
-        
-        const char* rawName = file.name();
-        const char* displayName = rawName;
-        
-        const char* lastSlash = strrchr(rawName, '/');
-        if (lastSlash) {
-            displayName = lastSlash + 1;
-        }
-        
-        strncpy(entry.name, displayName, FILENAME_MAX_LEN - 1);
-        entry.name[FILENAME_MAX_LEN - 1] = '\0';
-        entry.isDirectory = file.isDirectory();
-        entry.size = file.size();
-        
-        fileList.push_back(entry);
-        
+    for (const file_entry_t& entry : fileList) {
         const char* icon = entry.isDirectory ? LV_SYMBOL_DIRECTORY : LV_SYMBOL_FILE;
         char displayNameBuf[FILENAME_MAX_LEN + 16];
         
@@ -282,12 +307,9 @@ void FileExplorerApp::refreshFileList() {
         lv_obj_t* btn = lv_list_add_btn(listFiles, icon, displayNameBuf);
         lv_obj_add_event_cb(btn, list_click_cb, LV_EVENT_CLICKED, this);
         
-        file = root.openNextFile();
         count++;
     }
     
-    root.close();
-    
     updatePathDisplay();
     updateStatusDisplay();
     
@@ -65,6 +65,7 @@ private:
     static void up_btn_cb(lv_event_t* e);
     static void switch_btn_cb(lv_event_t* e);
     static void list_click_cb(lv_event_t* e);
+    static bool list_entry_cb(const char* name, bool isDir, size_t size, void* ctx);
     static void select_btn_cb(lv_event_t* e);
     
 public:
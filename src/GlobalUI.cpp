@@ -3,6 +3,18 @@
 #include <lvgl.h>
 #include "BSP.h"
 
+// The sidebar is one opaque panel on the top layer holding the home and
+// app buttons, so opening or closing it is a single move. It has no
+// shadow: a soft shadow is re-blended on every frame that redraws
+// anything beneath it (chat scrolling, keyboard animation), while the
+// solid edge strip is a plain fill.
+#define SIDEBAR_WIDTH       50
+#define SIDEBAR_EDGE        2
+#define SIDEBAR_TOP         20
+#define SIDEBAR_BTN_TOP     20      // first app button, below home
+#define SIDEBAR_BTN_HEIGHT  30
+#define SIDEBAR_SLIDE_MS    150
+
 lv_obj_t *GlobalUI::sidebar = nullptr;
 lv_obj_t *GlobalUI::toggleBtn = nullptr;
 lv_obj_t *GlobalUI::homeBtn = nullptr;
@@ -76,57 +88,63 @@ void custom_btn_cb(lv_event_t *e) {
     }
 }
 
+static void sidebar_set_x(void* obj, int32_t x) {
+    lv_obj_set_x((lv_obj_t*)obj, x);
+}
+
+// Moving an opaque panel invalidates only its old and new position, which
+// LVGL joins into one strip per animation step
+void GlobalUI::setSidebarOpen(bool open, bool animate) {
+    sidebarOpen = open;
+    if (!sidebar) {
+        return;
+    }
+    
+    lv_coord_t target = open ? 0 : -(SIDEBAR_WIDTH + SIDEBAR_EDGE);
+    lv_anim_del(sidebar, sidebar_set_x);
+    if (animate) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, sidebar);
+        lv_anim_set_exec_cb(&a, sidebar_set_x);
+        lv_anim_set_values(&a, lv_obj_get_x(sidebar), target);
+        lv_anim_set_time(&a, SIDEBAR_SLIDE_MS);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+    } else {
+        lv_obj_set_x(sidebar, target);
+    }
+    
+    if (toggleBtn) {
+        lv_label_set_text(lv_obj_get_child(toggleBtn, 0), open ? LV_SYMBOL_LEFT : LV_SYMBOL_RIGHT);
+    }
+    
+    #if LV_USE_PERF_MONITOR
+    lv_obj_t* perf_label = find_perf_monitor_label();
+    if (perf_label) {
+        if (open) {
+            lv_obj_clear_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    #endif
+    #if LV_USE_MEM_MONITOR
+    lv_obj_t* mem_label = find_memory_monitor_label();
+    if (mem_label) {
+        if (open) {
+            lv_obj_clear_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    #endif
+}
+
 void toggle_sidebar(lv_event_t *e) {
     lv_event_code_t code = lv_event_get_code(e);
     if (code == LV_EVENT_CLICKED) {
-        if (GlobalUI::sidebarOpen) {
-            lv_obj_set_pos(GlobalUI::sidebar, -50, 20);
-            lv_label_set_text(lv_obj_get_child(GlobalUI::toggleBtn, 0), LV_SYMBOL_RIGHT);
-            if (GlobalUI::homeBtn) {
-                lv_obj_add_flag(GlobalUI::homeBtn, LV_OBJ_FLAG_HIDDEN);
-            }
-            for (int i = 0; i < GlobalUI::customButtonCount; i++) {
-                if (GlobalUI::customButtons[i]) {
-                    lv_obj_add_flag(GlobalUI::customButtons[i], LV_OBJ_FLAG_HIDDEN);
-                }
-            }
-            #if LV_USE_PERF_MONITOR
-            lv_obj_t* perf_label = find_perf_monitor_label();
-            if (perf_label) {
-                lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
-            }
-            #endif
-            #if LV_USE_MEM_MONITOR
-            lv_obj_t* mem_label = find_memory_monitor_label();
-            if (mem_label) {
-                lv_obj_add_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
-            }
-            #endif
-        } else {
-            lv_obj_set_pos(GlobalUI::sidebar, 0, 20);
-            lv_label_set_text(lv_obj_get_child(GlobalUI::toggleBtn, 0), LV_SYMBOL_LEFT);
-            if (GlobalUI::homeBtn) {
-                lv_obj_clear_flag(GlobalUI::homeBtn, LV_OBJ_FLAG_HIDDEN);
-            }
-            for (int i = 0; i < GlobalUI::customButtonCount; i++) {
-                if (GlobalUI::customButtons[i]) {
-                    lv_obj_clear_flag(GlobalUI::customButtons[i], LV_OBJ_FLAG_HIDDEN);
-                }
-            }
-            #if LV_USE_PERF_MONITOR
-            lv_obj_t* perf_label = find_perf_monitor_label();
-            if (perf_label) {
-                lv_obj_clear_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
-            }
-            #endif
-            #if LV_USE_MEM_MONITOR
-            lv_obj_t* mem_label = find_memory_monitor_label();
-            if (mem_label) {
-                lv_obj_clear_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
-            }
-            #endif
-        }
-        GlobalUI::sidebarOpen = !GlobalUI::sidebarOpen;
+        GlobalUI::getInstance().setSidebarOpen(!GlobalUI::sidebarOpen, true);
     }
 }
 
@@ -139,6 +157,7 @@ void GlobalUI::init() {
         lv_obj_set_style_bg_color(toggleBtn, lv_color_make(0x80, 0x80, 0x80), 0);
         lv_obj_set_style_border_width(toggleBtn, 0, 0);
         lv_obj_set_style_radius(toggleBtn, 0, 0);
+        lv_obj_set_style_shadow_width(toggleBtn, 0, 0);
 
         lv_obj_t *arrow = lv_label_create(toggleBtn);
         lv_label_set_text(arrow, sidebarOpen ? LV_SYMBOL_LEFT : LV_SYMBOL_RIGHT);
@@ -149,73 +168,41 @@ void GlobalUI::init() {
 
     if (!sidebar) {
         sidebar = lv_obj_create(lv_layer_top());
-        lv_obj_set_size(sidebar, 50, lv_disp_get_ver_res(lv_disp_get_default()) - 20);
-        lv_obj_align(sidebar, LV_ALIGN_TOP_LEFT, sidebarOpen ? 0 : -50, 20);
+        lv_obj_remove_style_all(sidebar);
+        lv_obj_set_size(sidebar, SIDEBAR_WIDTH + SIDEBAR_EDGE,
+                        lv_disp_get_ver_res(lv_disp_get_default()) - SIDEBAR_TOP);
         lv_obj_set_style_bg_color(sidebar, lv_color_make(0xD0, 0xD0, 0xD0), 0);
-        lv_obj_set_style_border_width(sidebar, 0, 0);
-        lv_obj_set_style_radius(sidebar, 0, 0);
-        lv_obj_set_style_shadow_width(sidebar, 2, 0);
-        lv_obj_set_style_shadow_color(sidebar, lv_color_make(0x00, 0x00, 0x00), 0);
-        lv_obj_set_style_shadow_ofs_x(sidebar, 2, 0);
-        lv_obj_set_style_shadow_ofs_y(sidebar, 0, 0);
-        lv_obj_set_style_shadow_opa(sidebar, 100, 0);
-        lv_obj_set_style_pad_all(sidebar, 0, 0);
+        lv_obj_set_style_bg_opa(sidebar, LV_OPA_COVER, 0);
+        lv_obj_clear_flag(sidebar, LV_OBJ_FLAG_SCROLLABLE);
         
-        #if LV_USE_PERF_MONITOR
-        lv_obj_t* perf_label = find_perf_monitor_label();
-        if (perf_label) {
-            if (sidebarOpen) {
-                lv_obj_clear_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
-            } else {
-                lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
-            }
-        }
-        #endif
+        lv_obj_t* edge = lv_obj_create(sidebar);
+        lv_obj_remove_style_all(edge);
+        lv_obj_set_size(edge, SIDEBAR_EDGE, LV_PCT(100));
+        lv_obj_set_pos(edge, SIDEBAR_WIDTH, 0);
+        lv_obj_set_style_bg_color(edge, lv_color_make(0x60, 0x60, 0x60), 0);
+        lv_obj_set_style_bg_opa(edge, LV_OPA_COVER, 0);
+        lv_obj_clear_flag(edge, LV_OBJ_FLAG_CLICKABLE);
         
-        #if LV_USE_MEM_MONITOR
-        lv_obj_t* mem_label = find_memory_monitor_label();
-        if (mem_label) {
-            if (sidebarOpen) {
-                lv_obj_clear_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
-            } else {
-                lv_obj_add_flag(mem_label, LV_OBJ_FLAG_HIDDEN);
-            }
-        }
-        #endif
-    } else {
-        lv_obj_set_pos(sidebar, sidebarOpen ? 0 : -50, 20);
+        lv_obj_set_pos(sidebar, sidebarOpen ? 0 : -(SIDEBAR_WIDTH + SIDEBAR_EDGE), SIDEBAR_TOP);
     }
+    setSidebarOpen(sidebarOpen, false);
 
     if (!homeBtn) {
-        homeBtn = lv_btn_create(lv_layer_top());
-        lv_obj_set_size(homeBtn, 50, 20);
-        lv_obj_set_pos(homeBtn, 0, 20);
+        homeBtn = lv_btn_create(sidebar);
+        lv_obj_set_size(homeBtn, SIDEBAR_WIDTH, 20);
+        lv_obj_set_pos(homeBtn, 0, 0);
         lv_obj_add_event_cb(homeBtn, home_btn_cb, LV_EVENT_CLICKED, NULL);
         lv_obj_set_style_bg_color(homeBtn, lv_color_make(0x80, 0x80, 0x80), 0);
         lv_obj_set_style_border_width(homeBtn, 0, 0);
         lv_obj_set_style_radius(homeBtn, 0, 0);
+        lv_obj_set_style_shadow_width(homeBtn, 0, 0);
         
         lv_obj_t *homeLabel = lv_label_create(homeBtn);
         lv_label_set_text(homeLabel, LV_SYMBOL_HOME);
         lv_obj_center(homeLabel);
         lv_obj_set_style_text_color(homeLabel, lv_color_white(), 0);
         lv_obj_set_style_text_font(homeLabel, &lv_font_montserrat_14, 0);
-        
-        if (!sidebarOpen) {
-            lv_obj_add_flag(homeBtn, LV_OBJ_FLAG_HIDDEN);
-        }
     }
-
-    static const lv_style_prop_t props[] = {
-        LV_STYLE_TRANSLATE_X,
-        LV_STYLE_TRANSLATE_Y,
-        LV_STYLE_OPA,
-        LV_STYLE_PROP_INV
-    };
-    
-    lv_style_transition_dsc_t transition;
-    lv_style_transition_dsc_init(&transition, props, lv_anim_path_linear, 200, 0, NULL);
-    lv_obj_set_style_transition(sidebar, &transition, 0);
 }
 
 void GlobalUI::deinit() {
@@ -240,22 +227,24 @@ bool GlobalUI::isSidebarOpen() {
 }
 
 void GlobalUI::toggleSidebar() {
-    if (toggleBtn) {
-        lv_event_send(toggleBtn, LV_EVENT_CLICKED, NULL);
-    }
+    setSidebarOpen(!sidebarOpen, true);
 }
 
 lv_obj_t* GlobalUI::addSidebarButton(const char* symbol, sidebar_btn_callback_t callback, void* user_data) {
     if (customButtonCount >= MAX_SIDEBAR_BUTTONS) {
         return nullptr;
     }
+    if (!sidebar) {
+        init();
+    }
     
-    lv_obj_t* btn = lv_btn_create(lv_layer_top());
-    lv_obj_set_size(btn, 50, 30);
-    lv_obj_set_pos(btn, 0, 40 + customButtonCount * 30);
+    lv_obj_t* btn = lv_btn_create(sidebar);
+    lv_obj_set_size(btn, SIDEBAR_WIDTH, SIDEBAR_BTN_HEIGHT);
+    lv_obj_set_pos(btn, 0, SIDEBAR_BTN_TOP + customButtonCount * SIDEBAR_BTN_HEIGHT);
     lv_obj_set_style_bg_color(btn, lv_color_make(0x80, 0x80, 0x80), 0);
     lv_obj_set_style_border_width(btn, 0, 0);
     lv_obj_set_style_radius(btn, 0, 0);
+    lv_obj_set_style_shadow_width(btn, 0, 0);
     
     lv_obj_t* label = lv_label_create(btn);
     lv_label_set_text(label, symbol);
@@ -272,13 +261,10 @@ lv_obj_t* GlobalUI::addSidebarButton(const char* symbol, sidebar_btn_callback_t
     
     lv_obj_add_event_cb(btn, custom_btn_cb, LV_EVENT_CLICKED, NULL);
     
-    if (!sidebarOpen) {
-        lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
-    }
-    
     customButtons[customButtonCount++] = btn;
     
-    Serial.printf("[GlobalUI] Added sidebar button %d at y=%d\n", customButtonCount - 1, 40 + (customButtonCount - 1) * 30);
+    Serial.printf("[GlobalUI] Added sidebar button %d at y=%d\n", customButtonCount - 1,
+        SIDEBAR_TOP + SIDEBAR_BTN_TOP + (customButtonCount - 1) * SIDEBAR_BTN_HEIGHT);
     
     return btn;
 }
@@ -297,7 +283,7 @@ void GlobalUI::removeSidebarButton(lv_obj_t* btn) {
             for (int j = i; j < customButtonCount - 1; j++) {
                 customButtons[j] = customButtons[j + 1];
                 if (customButtons[j]) {
-                    lv_obj_set_pos(customButtons[j], 0, 40 + j * 30);
+                    lv_obj_set_pos(customButtons[j], 0, SIDEBAR_BTN_TOP + j * SIDEBAR_BTN_HEIGHT);
                 }
             }
             customButtons[customButtonCount - 1] = nullptr;
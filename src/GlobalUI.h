@@ -35,6 +35,7 @@ public:
     void deinit();
     bool isSidebarOpen();
     void toggleSidebar();
+    void setSidebarOpen(bool open, bool animate);
     
     lv_obj_t* addSidebarButton(const char* symbol, sidebar_btn_callback_t callback, void* user_data);
     void removeSidebarButton(lv_obj_t* btn);
@@ -0,0 +1,209 @@
+#include "GlyphCache.h"
+#include <stdlib.h>
+#include <string.h>
+
+GlyphCache::GlyphCache() {
+    capacity = 0;
+    slotSize = 0;
+    glyphBytes = 0;
+    used = 0;
+    hashMask = 0;
+    hashShift = 0;
+    unicodes = nullptr;
+    bitmaps = nullptr;
+    hash = nullptr;
+    lruPrev = nullptr;
+    lruNext = nullptr;
+    lruHead = -1;
+    lruTail = -1;
+    memset(&stats, 0, sizeof(stats));
+}
+
+GlyphCache::~GlyphCache() {
+    release();
+}
+
+int GlyphCache::capacityFor(int requested, int glyphBytes) {
+    int slotBytes = (glyphBytes + 3) & ~3;
+    int budgetSlots = XFONT_CACHE_MAX_BYTES / slotBytes;
+    
+    if (requested < XFONT_CACHE_MIN) requested = XFONT_CACHE_MIN;
+    if (requested > XFONT_CACHE_MAX) requested = XFONT_CACHE_MAX;
+    if (requested > budgetSlots) requested = budgetSlots;
+    return requested;
+}
+
+bool GlyphCache::allocate(int requested, int bytes) {
+    release();
+    
+    // Slots hold one full-width glyph at the font's depth, word aligned.
+    int size = (bytes + 3) & ~3;
+    int slots = capacityFor(requested, bytes);
+    
+    // Hash table at least twice the slot count keeps probe chains short.
+    int hashBits = 1;
+    while ((1 << hashBits) < slots * 2) hashBits++;
+    int hashSize = 1 << hashBits;
+    
+    // Halve the capacity until it fits; a small cache beats none.
+    while (slots >= XFONT_CACHE_MIN) {
+        unicodes = (uint32_t*)malloc(slots * sizeof(uint32_t));
+        bitmaps = (uint8_t*)malloc(slots * size);
+        lruPrev = (int16_t*)malloc(slots * sizeof(int16_t));
+        lruNext = (int16_t*)malloc(slots * sizeof(int16_t));
+        hash = (int16_t*)malloc(hashSize * sizeof(int16_t));
+        if (unicodes && bitmaps && lruPrev && lruNext && hash) {
+            break;
+        }
+        release();
+        slots /= 2;
+        hashSize /= 2;
+        hashBits--;
+    }
+    
+    if (!hash) {
+        return false;
+    }
+    
+    for (int i = 0; i < hashSize; i++) {
+        hash[i] = -1;
+    }
+    capacity = slots;
+    slotSize = size;
+    glyphBytes = bytes;
+    hashMask = hashSize - 1;
+    hashShift = 32 - hashBits;
+    memset(&stats, 0, sizeof(stats));
+    stats.capacity = slots;
+    return true;
+}
+
+void GlyphCache::release() {
+    free(unicodes);
+    free(bitmaps);
+    free(hash);
+    free(lruPrev);
+    free(lruNext);
+    unicodes = nullptr;
+    bitmaps = nullptr;
+    hash = nullptr;
+    lruPrev = nullptr;
+    lruNext = nullptr;
+    capacity = 0;
+    used = 0;
+    lruHead = -1;
+    lruTail = -1;
+    stats.capacity = 0;
+    stats.used = 0;
+}
+
+size_t GlyphCache::getMemoryUsage() const {
+    if (capacity == 0) return 0;
+    return capacity * (sizeof(uint32_t) + slotSize + 2 * sizeof(int16_t)) + (hashMask + 1) * sizeof(int16_t);
+}
+
+void GlyphCache::resetStats() {
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+}
+
+int GlyphCache::hashSlot(uint32_t unicode) const {
+    return (uint32_t)(unicode * 2654435761UL) >> hashShift;
+}
+
+void GlyphCache::hashRemove(uint32_t unicode) {
+    int i = hashSlot(unicode);
+    while (hash[i] >= 0 && unicodes[hash[i]] != unicode) {
+        i = (i + 1) & hashMask;
+    }
+    if (hash[i] < 0) return;
+    
+    // Backward-shift deletion: pull later entries of the probe chain into
+    // the hole so lookups never need tombstones.
+    int j = i;
+    while (true) {
+        j = (j + 1) & hashMask;
+        if (hash[j] < 0) break;
+        int home = hashSlot(unicodes[hash[j]]);
+        bool movable = (j > i) ? (home <= i || home > j) : (home <= i && home > j);
+        if (movable) {
+            hash[i] = hash[j];
+            i = j;
+        }
+    }
+    hash[i] = -1;
+}
+
+void GlyphCache::lruUnlink(int slot) {
+    int p = lruPrev[slot];
+    int n = lruNext[slot];
+    if (p >= 0) lruNext[p] = n; else lruHead = n;
+    if (n >= 0) lruPrev[n] = p; else lruTail = p;
+}
+
+void GlyphCache::lruPushFront(int slot) {
+    lruPrev[slot] = -1;
+    lruNext[slot] = lruHead;
+    if (lruHead >= 0) lruPrev[lruHead] = slot;
+    lruHead = slot;
+    if (lruTail < 0) lruTail = slot;
+}
+
+int GlyphCache::find(uint32_t unicode) {
+    if (capacity == 0) return -1;
+    
+    int i = hashSlot(unicode);
+    while (hash[i] >= 0) {
+        int slot = hash[i];
+        if (unicodes[slot] == unicode) {
+            if (slot != lruHead) {
+                lruUnlink(slot);
+                lruPushFront(slot);
+            }
+            return slot;
+        }
+        i = (i + 1) & hashMask;
+    }
+    return -1;
+}
+
+bool GlyphCache::copy(uint32_t unicode, uint8_t* out) {
+    int slot = find(unicode);
+    if (slot >= 0) {
+        memcpy(out, bitmaps + slot * slotSize, glyphBytes);
+        stats.hits++;
+    } else {
+        stats.misses++;
+    }
+    return slot >= 0;
+}
+
+bool GlyphCache::contains(uint32_t unicode) {
+    return find(unicode) >= 0;
+}
+
+void GlyphCache::insert(uint32_t unicode, const uint8_t* bitmap) {
+    if (capacity == 0 || find(unicode) >= 0) return;
+    
+    int slot;
+    if (used < capacity) {
+        slot = used++;
+        stats.used = used;
+    } else {
+        slot = lruTail;
+        hashRemove(unicodes[slot]);
+        lruUnlink(slot);
+        stats.evictions++;
+    }
+    
+    unicodes[slot] = unicode;
+    memcpy(bitmaps + slot * slotSize, bitmap, glyphBytes);
+    
+    int i = hashSlot(unicode);
+    while (hash[i] >= 0) {
+        i = (i + 1) & hashMask;
+    }
+    hash[i] = slot;
+    lruPushFront(slot);
+}
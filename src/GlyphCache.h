@@ -0,0 +1,78 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define XFONT_CACHE_DEFAULT     128
+#define XFONT_CACHE_MIN         16
+#define XFONT_CACHE_MAX         512
+// RAM ceiling for cached bitmaps; deeper glyphs get fewer slots
+#define XFONT_CACHE_MAX_BYTES   36864
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint16_t capacity;
+    uint16_t used;
+} xfont_cache_stats_t;
+
+// Glyph cache behind XFontAdapter: open-addressed hash (linear probing)
+// over slot indices, LRU order kept as a doubly linked list through
+// lruPrev/lruNext. Allocated once; slots hold one glyph at the font's depth.
+//
+// Not locked; XFontAdapter holds cacheMux around every call. Plain C++
+// with no Arduino headers, so the native test env builds it.
+class GlyphCache {
+private:
+    int capacity;
+    int slotSize;
+    int glyphBytes;
+    int used;
+    int hashMask;
+    int hashShift;
+    uint32_t* unicodes;
+    uint8_t* bitmaps;
+    int16_t* hash;
+    int16_t* lruPrev;
+    int16_t* lruNext;
+    int16_t lruHead;
+    int16_t lruTail;
+    xfont_cache_stats_t stats;
+    
+    int hashSlot(uint32_t unicode) const;
+    void hashRemove(uint32_t unicode);
+    void lruUnlink(int slot);
+    void lruPushFront(int slot);
+    int find(uint32_t unicode);
+
+public:
+    GlyphCache();
+    ~GlyphCache();
+    
+    // Slot count for a requested capacity: clamped to XFONT_CACHE_MIN..MAX
+    // and to what fits XFONT_CACHE_MAX_BYTES at this glyph size
+    static int capacityFor(int requested, int glyphBytes);
+    // Halves the capacity until the allocation fits; false if even
+    // XFONT_CACHE_MIN slots do not
+    bool allocate(int requested, int glyphBytes);
+    void release();
+    
+    int getCapacity() const { return capacity; }
+    int getSlotSize() const { return slotSize; }
+    size_t getMemoryUsage() const;
+    
+    // Copies a cached glyph into out and counts a hit, or counts a miss
+    bool copy(uint32_t unicode, uint8_t* out);
+    // Refreshes the glyph's LRU position without counting
+    bool contains(uint32_t unicode);
+    // Evicts the least recently used glyph when full. A glyph that is
+    // already cached is left as is.
+    void insert(uint32_t unicode, const uint8_t* bitmap);
+    
+    const xfont_cache_stats_t& getStats() const { return stats; }
+    void resetStats();
+};
+
+#endif
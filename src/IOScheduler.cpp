@@ -0,0 +1,487 @@
+#include "IOScheduler.h"
+#include <SD.h>
+
+IOScheduler SdIO;
+
+static const uint32_t ioBudgetMs[IO_PRIO_COUNT] = {
+    IO_BUDGET_INTERACTIVE_MS,
+    IO_BUDGET_NORMAL_MS,
+    IO_BUDGET_BACKGROUND_MS
+};
+
+static const char* const ioClassNames[IO_PRIO_COUNT] = {"interactive", "normal", "background"};
+
+IOScheduler::IOScheduler()
+    : _mux(portMUX_INITIALIZER_UNLOCKED)
+    , _space(nullptr)
+    , _task(nullptr)
+    , _seq(0)
+    , _batches(0)
+    , _coalesced(0)
+{
+    memset(_slots, 0, sizeof(_slots));
+    memset(_requests, 0, sizeof(_requests));
+    memset(_waitTotalUs, 0, sizeof(_waitTotalUs));
+    memset(_waitWorstUs, 0, sizeof(_waitWorstUs));
+    memset(_serviceTotalUs, 0, sizeof(_serviceTotalUs));
+    memset(_deadlineMisses, 0, sizeof(_deadlineMisses));
+}
+
+bool IOScheduler::begin() {
+    if (_task) return true;
+
+    _space = xSemaphoreCreateCounting(IO_QUEUE_LEN, IO_QUEUE_LEN);
+    if (!_space) {
+        Serial.println("[SdIO] Failed to create queue semaphore");
+        return false;
+    }
+
+    for (int i = 0; i < IO_QUEUE_LEN; i++) {
+        _slots[i].doneSem = xSemaphoreCreateBinary();
+        if (!_slots[i].doneSem) {
+            Serial.println("[SdIO] Failed to create slot semaphore");
+            return false;
+        }
+    }
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        taskEntry,
+        "SdIO",
+        IO_TASK_STACK_SIZE,
+        this,
+        IO_TASK_PRIORITY,
+        &_task,
+        IO_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        _task = nullptr;
+        Serial.println("[SdIO] Failed to create IO task");
+        return false;
+    }
+
+    Serial.println("[SdIO] IO scheduler started");
+    return true;
+}
+
+io_slot_t* IOScheduler::enqueue(const io_request_t& req, bool sync) {
+    if (req.path && strlen(req.path) >= IO_PATH_MAX) {
+        Serial.printf("[SdIO] Path too long: %s\n", req.path);
+        return nullptr;
+    }
+
+    uint8_t* copy = nullptr;
+    if ((req.op == IO_OP_WRITE || req.op == IO_OP_APPEND) && req.len > 0) {
+        copy = (uint8_t*)malloc(req.len);
+        if (!copy) return nullptr;
+        memcpy(copy, req.data, req.len);
+    }
+
+    // The IO task itself must not wait on a slot only it can free
+    TickType_t wait = xTaskGetCurrentTaskHandle() == _task ? 0 : pdMS_TO_TICKS(IO_SUBMIT_WAIT_MS);
+    if (xSemaphoreTake(_space, wait) != pdTRUE) {
+        free(copy);
+        return nullptr;
+    }
+
+    io_slot_t* slot = nullptr;
+    portENTER_CRITICAL(&_mux);
+    for (int i = 0; i < IO_QUEUE_LEN; i++) {
+        if (_slots[i].state == IO_SLOT_FREE) {
+            slot = &_slots[i];
+            break;
+        }
+    }
+    slot->req = req;
+    if (req.path) {
+        strcpy(slot->path, req.path);
+    } else {
+        slot->path[0] = '\0';
+    }
+    slot->req.path = slot->path;
+    slot->req.data = copy;
+    slot->copy = copy;
+    slot->seq = ++_seq;
+    slot->submitUs = micros();
+    slot->deadline = millis() + (req.deadlineMs ? req.deadlineMs : ioBudgetMs[req.prio]);
+    slot->result = -1;
+    slot->sync = sync;
+    slot->state = IO_SLOT_QUEUED;
+    portEXIT_CRITICAL(&_mux);
+
+    xTaskNotifyGive(_task);
+    return slot;
+}
+
+// Picks the request with the earliest deadline, then the requests that can
+// share its open. Caller runs the batch; slots are marked running here.
+int IOScheduler::nextBatch(io_slot_t** batch) {
+    portENTER_CRITICAL(&_mux);
+
+    io_slot_t* best = nullptr;
+    for (int i = 0; i < IO_QUEUE_LEN; i++) {
+        io_slot_t* s = &_slots[i];
+        if (s->state != IO_SLOT_QUEUED) continue;
+        if (!best || (int32_t)(s->deadline - best->deadline) < 0 ||
+            (s->deadline == best->deadline && s->seq < best->seq)) {
+            best = s;
+        }
+    }
+
+    if (!best) {
+        portEXIT_CRITICAL(&_mux);
+        return 0;
+    }
+
+    // Requests for one path run in submission order
+    if (best->path[0]) {
+        for (int i = 0; i < IO_QUEUE_LEN; i++) {
+            io_slot_t* s = &_slots[i];
+            if (s->state == IO_SLOT_QUEUED && s->seq < best->seq && strcmp(s->path, best->path) == 0) {
+                best = s;
+            }
+        }
+    }
+
+    batch[0] = best;
+    best->state = IO_SLOT_RUNNING;
+    int count = 1;
+
+    io_op_t op = best->req.op;
+    bool canCoalesce = op == IO_OP_READ || op == IO_OP_WRITE || op == IO_OP_APPEND;
+
+    while (canCoalesce && count < IO_BATCH_MAX) {
+        io_slot_t* last = batch[count - 1];
+        io_slot_t* next = nullptr;
+        for (int i = 0; i < IO_QUEUE_LEN; i++) {
+            io_slot_t* s = &_slots[i];
+            if (s->state != IO_SLOT_QUEUED || s->seq < last->seq) continue;
+            if (strcmp(s->path, last->path) != 0) continue;
+            if (!next || s->seq < next->seq) next = s;
+        }
+        if (!next) break;
+
+        bool fits;
+        if (op == IO_OP_READ) {
+            fits = next->req.op == IO_OP_READ && next->req.offset == last->req.offset + last->req.len;
+        } else {
+            fits = next->req.op == IO_OP_APPEND;
+        }
+        if (!fits) break;
+
+        next->state = IO_SLOT_RUNNING;
+        batch[count++] = next;
+    }
+
+    _batches++;
+    _coalesced += count - 1;
+    portEXIT_CRITICAL(&_mux);
+    return count;
+}
+
+void IOScheduler::runBatch(io_slot_t** batch, int count) {
+    io_slot_t* first = batch[0];
+    io_request_t& req = first->req;
+
+    switch (req.op) {
+        case IO_OP_READ: {
+            File f = SD.open(first->path, FILE_READ);
+            if (f && req.offset) f.seek(req.offset);
+            for (int i = 0; i < count; i++) {
+                io_request_t& r = batch[i]->req;
+                batch[i]->result = f ? (int)f.read((uint8_t*)r.buf, r.len) : -1;
+            }
+            if (f) f.close();
+            break;
+        }
+
+        case IO_OP_WRITE:
+        case IO_OP_APPEND: {
+            File f = SD.open(first->path, req.op == IO_OP_WRITE ? FILE_WRITE : FILE_APPEND);
+            for (int i = 0; i < count; i++) {
+                io_request_t& r = batch[i]->req;
+                if (!f) {
+                    batch[i]->result = -1;
+                } else {
+                    batch[i]->result = r.len ? (int)f.write((const uint8_t*)r.data, r.len) : 0;
+                }
+            }
+            if (f) f.close();
+            break;
+        }
+
+        default:
+            first->result = runInline(req);
+            break;
+    }
+}
+
+// The single-request operations, also used directly by call() when the
+// scheduler cannot be waited on
+int IOScheduler::runInline(const io_request_t& req) {
+    switch (req.op) {
+        case IO_OP_READ: {
+            File f = SD.open(req.path, FILE_READ);
+            if (!f) return -1;
+            if (req.offset) f.seek(req.offset);
+            int n = f.read((uint8_t*)req.buf, req.len);
+            f.close();
+            return n;
+        }
+
+        case IO_OP_WRITE:
+        case IO_OP_APPEND: {
+            File f = SD.open(req.path, req.op == IO_OP_WRITE ? FILE_WRITE : FILE_APPEND);
+            if (!f) return -1;
+            int n = req.len ? f.write((const uint8_t*)req.data, req.len) : 0;
+            f.close();
+            return n;
+        }
+
+        case IO_OP_REMOVE:
+            return SD.remove(req.path) ? 0 : -1;
+
+        case IO_OP_LIST: {
+            File dir = SD.open(req.path);
+            if (!dir || !dir.isDirectory()) return -1;
+            int count = 0;
+            File entry = dir.openNextFile();
+            while (entry) {
+                count++;
+                bool more = req.entry(entry.name(), entry.isDirectory(), entry.size(), req.ctx);
+                entry.close();
+                if (!more) break;
+                entry = dir.openNextFile();
+            }
+            dir.close();
+            return count;
+        }
+
+        case IO_OP_EXEC:
+            return req.fn ? req.fn(req.ctx) : -1;
+    }
+    return -1;
+}
+
+void IOScheduler::complete(io_slot_t* slot, uint32_t startUs, uint32_t endUs) {
+    io_prio_t prio = slot->req.prio;
+    uint32_t waitUs = startUs - slot->submitUs;
+    bool missed = (int32_t)(millis() - slot->deadline) > 0;
+
+    portENTER_CRITICAL(&_mux);
+    _requests[prio]++;
+    _waitTotalUs[prio] += waitUs;
+    if (waitUs > _waitWorstUs[prio]) _waitWorstUs[prio] = waitUs;
+    _serviceTotalUs[prio] += endUs - startUs;
+    if (missed) _deadlineMisses[prio]++;
+
+    if (slot->sync) {
+        slot->state = IO_SLOT_DONE;
+        portEXIT_CRITICAL(&_mux);
+        xSemaphoreGive(slot->doneSem);
+        return;
+    }
+    portEXIT_CRITICAL(&_mux);
+
+    if (slot->req.done) {
+        slot->req.done(slot->result, slot->req.ctx);
+    }
+    releaseSlot(slot);
+}
+
+void IOScheduler::releaseSlot(io_slot_t* slot) {
+    free(slot->copy);
+    slot->copy = nullptr;
+
+    portENTER_CRITICAL(&_mux);
+    slot->state = IO_SLOT_FREE;
+    portEXIT_CRITICAL(&_mux);
+
+    xSemaphoreGive(_space);
+}
+
+void IOScheduler::taskEntry(void* arg) {
+    IOScheduler* self = (IOScheduler*)arg;
+    io_slot_t* batch[IO_BATCH_MAX];
+
+    while (true) {
+        int count = self->nextBatch(batch);
+        if (!count) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        uint32_t startUs = micros();
+        self->runBatch(batch, count);
+        uint32_t endUs = micros();
+
+        for (int i = 0; i < count; i++) {
+            self->complete(batch[i], startUs, endUs);
+        }
+    }
+}
+
+bool IOScheduler::submit(const io_request_t& req) {
+    if (!_task) return false;
+    return enqueue(req, false) != nullptr;
+}
+
+int IOScheduler::call(const io_request_t& req) {
+    if (!_task || xTaskGetCurrentTaskHandle() == _task) {
+        return runInline(req);
+    }
+
+    io_slot_t* slot = enqueue(req, true);
+    if (!slot) return -1;
+
+    xSemaphoreTake(slot->doneSem, portMAX_DELAY);
+    int result = slot->result;
+    releaseSlot(slot);
+    return result;
+}
+
+int IOScheduler::read(const char* path, void* buf, size_t len, io_prio_t prio, uint32_t offset) {
+    io_request_t req = {};
+    req.op = IO_OP_READ;
+    req.prio = prio;
+    req.path = path;
+    req.offset = offset;
+    req.buf = buf;
+    req.len = len;
+    return call(req);
+}
+
+bool IOScheduler::write(const char* path, const void* data, size_t len, io_prio_t prio,
+                        io_done_cb_t done, void* ctx) {
+    io_request_t req = {};
+    req.op = IO_OP_WRITE;
+    req.prio = prio;
+    req.path = path;
+    req.data = data;
+    req.len = len;
+    req.done = done;
+    req.ctx = ctx;
+    return submit(req);
+}
+
+bool IOScheduler::append(const char* path, const void* data, size_t len, io_prio_t prio,
+                         io_done_cb_t done, void* ctx) {
+    io_request_t req = {};
+    req.op = IO_OP_APPEND;
+    req.prio = prio;
+    req.path = path;
+    req.data = data;
+    req.len = len;
+    req.done = done;
+    req.ctx = ctx;
+    return submit(req);
+}
+
+bool IOScheduler::remove(const char* path, io_prio_t prio, io_done_cb_t done, void* ctx) {
+    io_request_t req = {};
+    req.op = IO_OP_REMOVE;
+    req.prio = prio;
+    req.path = path;
+    req.done = done;
+    req.ctx = ctx;
+    return submit(req);
+}
+
+int IOScheduler::list(const char* path, io_entry_cb_t entry, void* ctx, io_prio_t prio) {
+    io_request_t req = {};
+    req.op = IO_OP_LIST;
+    req.prio = prio;
+    req.path = path;
+    req.entry = entry;
+    req.ctx = ctx;
+    return call(req);
+}
+
+int IOScheduler::run(io_exec_fn_t fn, void* ctx, io_prio_t prio, const char* path) {
+    io_request_t req = {};
+    req.op = IO_OP_EXEC;
+    req.prio = prio;
+    req.path = path;
+    req.fn = fn;
+    req.ctx = ctx;
+    return call(req);
+}
+
+static int flush_noop(void* ctx) {
+    return 0;
+}
+
+void IOScheduler::flush(const char* path, io_prio_t prio) {
+    // Same-path requests run in order, so this returns once those ahead are done
+    run(flush_noop, nullptr, prio, path);
+}
+
+void IOScheduler::cancel(void* ctx) {
+    if (!_task || !ctx) return;
+
+    io_slot_t* dropped[IO_QUEUE_LEN];
+    int count = 0;
+
+    portENTER_CRITICAL(&_mux);
+    for (int i = 0; i < IO_QUEUE_LEN; i++) {
+        io_slot_t* s = &_slots[i];
+        if (s->state == IO_SLOT_QUEUED && !s->sync && s->req.ctx == ctx) {
+            // Taken off the queue here, freed outside the lock
+            s->state = IO_SLOT_RUNNING;
+            s->req.ctx = nullptr;
+            s->req.done = nullptr;
+            dropped[count++] = s;
+        }
+    }
+    portEXIT_CRITICAL(&_mux);
+
+    for (int i = 0; i < count; i++) {
+        releaseSlot(dropped[i]);
+    }
+
+    if (xTaskGetCurrentTaskHandle() == _task) return;
+
+    while (true) {
+        bool running = false;
+        portENTER_CRITICAL(&_mux);
+        for (int i = 0; i < IO_QUEUE_LEN; i++) {
+            if (_slots[i].state == IO_SLOT_RUNNING && !_slots[i].sync && _slots[i].req.ctx == ctx) {
+                running = true;
+            }
+        }
+        portEXIT_CRITICAL(&_mux);
+        if (!running) break;
+        vTaskDelay(1);
+    }
+}
+
+io_class_stats_t IOScheduler::getStats(io_prio_t prio) {
+    io_class_stats_t stats = {};
+
+    portENTER_CRITICAL(&_mux);
+    stats.requests = _requests[prio];
+    if (_requests[prio]) {
+        stats.waitAvgUs = _waitTotalUs[prio] / _requests[prio];
+        stats.serviceAvgUs = _serviceTotalUs[prio] / _requests[prio];
+    }
+    stats.waitWorstUs = _waitWorstUs[prio];
+    stats.deadlineMisses = _deadlineMisses[prio];
+    portEXIT_CRITICAL(&_mux);
+
+    return stats;
+}
+
+void IOScheduler::printStats() {
+    Serial.println("\n[SdIO] IO Scheduler");
+    Serial.println("----------------------");
+    Serial.printf("  Task: %s\n", _task ? "RUNNING" : "NOT STARTED");
+
+    for (int p = 0; p < IO_PRIO_COUNT; p++) {
+        io_class_stats_t stats = getStats((io_prio_t)p);
+        Serial.printf("  %-11s %u req, wait avg %u / max %u us, service %u us, %u late\n",
+                      ioClassNames[p], stats.requests, stats.waitAvgUs, stats.waitWorstUs,
+                      stats.serviceAvgUs, stats.deadlineMisses);
+    }
+
+    Serial.printf("  Batches: %u, coalesced: %u\n", _batches, _coalesced);
+    Serial.println("----------------------");
+}
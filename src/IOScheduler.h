@@ -0,0 +1,164 @@
+#ifndef IO_SCHEDULER_H
+#define IO_SCHEDULER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#define IO_TASK_STACK_SIZE      6144
+#define IO_TASK_PRIORITY        3
+#define IO_TASK_CORE            0
+#define IO_QUEUE_LEN            16
+#define IO_BATCH_MAX            8
+#define IO_PATH_MAX             96
+#define IO_SUBMIT_WAIT_MS       200     // how long submit() waits for a free slot
+
+// Default deadlines per class, from submission. Requests run earliest
+// deadline first, so interactive reads go ahead of background writes
+// unless those have waited long enough to be overdue.
+#define IO_BUDGET_INTERACTIVE_MS    20
+#define IO_BUDGET_NORMAL_MS         200
+#define IO_BUDGET_BACKGROUND_MS     2000
+
+typedef enum {
+    IO_PRIO_INTERACTIVE = 0,    // the user is waiting on it
+    IO_PRIO_NORMAL,
+    IO_PRIO_BACKGROUND,         // state savers, logs, temp files
+    IO_PRIO_COUNT
+} io_prio_t;
+
+typedef enum {
+    IO_OP_READ = 0,
+    IO_OP_WRITE,                // truncates
+    IO_OP_APPEND,
+    IO_OP_REMOVE,
+    IO_OP_LIST,
+    IO_OP_EXEC                  // run fn on the IO task, for code that walks a File itself
+} io_op_t;
+
+// result: bytes read or written, entries listed, fn's return value; < 0 on error
+typedef void (*io_done_cb_t)(int result, void* ctx);
+// Return false to stop the listing
+typedef bool (*io_entry_cb_t)(const char* name, bool isDir, size_t size, void* ctx);
+typedef int (*io_exec_fn_t)(void* ctx);
+
+typedef struct {
+    io_op_t op;
+    io_prio_t prio;
+    const char* path;           // copied; may be NULL for IO_OP_EXEC
+    uint32_t offset;            // READ
+    void* buf;                  // READ destination, valid until done
+    const void* data;           // WRITE/APPEND, copied on submit
+    size_t len;
+    io_entry_cb_t entry;        // LIST, called on the IO task
+    io_exec_fn_t fn;            // EXEC
+    void* ctx;
+    io_done_cb_t done;          // called on the IO task; use Perf.postUi() for LVGL
+    uint32_t deadlineMs;        // 0 for the class default
+} io_request_t;
+
+typedef struct {
+    uint32_t requests;
+    uint32_t waitAvgUs;         // submission to start of service
+    uint32_t waitWorstUs;
+    uint32_t serviceAvgUs;
+    uint32_t deadlineMisses;
+} io_class_stats_t;
+
+typedef enum {
+    IO_SLOT_FREE = 0,
+    IO_SLOT_QUEUED,
+    IO_SLOT_RUNNING,
+    IO_SLOT_DONE                // sync request, result waiting for its caller
+} io_slot_state_t;
+
+typedef struct {
+    io_request_t req;
+    char path[IO_PATH_MAX];
+    uint8_t* copy;              // owned WRITE/APPEND data
+    uint32_t seq;
+    uint32_t submitUs;
+    uint32_t deadline;          // millis()
+    int result;
+    io_slot_state_t state;
+    bool sync;
+    SemaphoreHandle_t doneSem;
+} io_slot_t;
+
+// Owns the SD card. Once it runs, every SD access goes through here: apps
+// submit requests or run their file walking as IO_OP_EXEC, and the S: LVGL
+// driver and the resource preloader make one call per device operation.
+// Only the mount and ConfigManager's boot-time read come before the task
+// starts and use SD directly.
+//
+// A long job (a dictionary scan) is split into several EXEC calls, so the
+// queue is served between them.
+//
+// Requests for the same path run in submission order. Consecutive reads of
+// adjacent ranges, and a write or append followed by appends, to one path
+// are coalesced into a single open.
+class IOScheduler {
+private:
+    io_slot_t _slots[IO_QUEUE_LEN];
+    portMUX_TYPE _mux;
+    SemaphoreHandle_t _space;   // counts free slots
+    TaskHandle_t _task;
+    uint32_t _seq;
+
+    uint32_t _requests[IO_PRIO_COUNT];
+    uint64_t _waitTotalUs[IO_PRIO_COUNT];
+    uint32_t _waitWorstUs[IO_PRIO_COUNT];
+    uint64_t _serviceTotalUs[IO_PRIO_COUNT];
+    uint32_t _deadlineMisses[IO_PRIO_COUNT];
+    uint32_t _batches;
+    uint32_t _coalesced;
+
+    io_slot_t* enqueue(const io_request_t& req, bool sync);
+    int nextBatch(io_slot_t** batch);
+    void runBatch(io_slot_t** batch, int count);
+    void complete(io_slot_t* slot, uint32_t startUs, uint32_t endUs);
+    void releaseSlot(io_slot_t* slot);
+
+    static int runInline(const io_request_t& req);
+    static void taskEntry(void* arg);
+
+public:
+    IOScheduler();
+
+    bool begin();
+    bool isRunning() const { return _task != nullptr; }
+
+    // Queues req; req.done gets the result on the IO task. False if the
+    // queue stayed full for IO_SUBMIT_WAIT_MS or the scheduler is not running.
+    bool submit(const io_request_t& req);
+    // Runs req and waits for it. Runs inline when called from the IO task
+    // or before begin().
+    int call(const io_request_t& req);
+
+    // Reads up to len bytes at offset and waits for them; -1 if path does not open
+    int read(const char* path, void* buf, size_t len, io_prio_t prio, uint32_t offset = 0);
+    bool write(const char* path, const void* data, size_t len, io_prio_t prio,
+               io_done_cb_t done = nullptr, void* ctx = nullptr);
+    bool append(const char* path, const void* data, size_t len, io_prio_t prio,
+                io_done_cb_t done = nullptr, void* ctx = nullptr);
+    bool remove(const char* path, io_prio_t prio, io_done_cb_t done = nullptr, void* ctx = nullptr);
+    int list(const char* path, io_entry_cb_t entry, void* ctx, io_prio_t prio);
+    int run(io_exec_fn_t fn, void* ctx, io_prio_t prio, const char* path = nullptr);
+    // Waits for the requests already queued for path, e.g. a state file
+    // that is about to be read back directly
+    void flush(const char* path, io_prio_t prio = IO_PRIO_INTERACTIVE);
+
+    // Drops queued requests for ctx and waits out one that is running, so
+    // no callback reaches ctx afterwards. Synchronous calls are not touched.
+    // Apps do not pass themselves as ctx: their queued saves must still
+    // land after the app is destroyed.
+    void cancel(void* ctx);
+
+    io_class_stats_t getStats(io_prio_t prio);
+    void printStats();
+};
+
+extern IOScheduler SdIO;
+
+#endif
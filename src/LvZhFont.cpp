@@ -38,14 +38,14 @@ bool LvZhFont::getGlyphDsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc, uint
     }
     
     int fontSize = XFontAdapter::instance.getFontSize();
-    bool isAscii = (unicode <= 127);
+    int glyphWidth = XFontAdapter::instance.getGlyphWidth(unicode);
     
-    dsc->adv_w = isAscii ? fontSize / 2 : fontSize;
-    dsc->box_w = isAscii ? fontSize / 2 : fontSize;
+    dsc->adv_w = glyphWidth;
+    dsc->box_w = glyphWidth;
     dsc->box_h = fontSize;
     dsc->ofs_x = 0;
     dsc->ofs_y = 0;
-    dsc->bpp = 1;
+    dsc->bpp = XFontAdapter::instance.getBpp();
     dsc->is_placeholder = 0;
     
     return true;
@@ -54,6 +54,15 @@ bool LvZhFont::getGlyphDsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc, uint
 const uint8_t* LvZhFont::getGlyphBitmap(const lv_font_t* font, uint32_t unicode) {
     statGetGlyphBitmapLv++;
     
+    const uint8_t* mapped = XFontAdapter::instance.getMappedGlyph(unicode);
+    if (mapped) {
+        return mapped;
+    }
+    
+    // LVGL draws from one task, so a single output buffer per font is enough.
     int width, height;
-    return XFontAdapter::instance.getGlyphBitmapPacked(unicode, &width, &height);
+    if (!XFontAdapter::instance.copyCachedGlyph(unicode, glyphBitmap, sizeof(glyphBitmap), &width, &height)) {
+        return nullptr;
+    }
+    return glyphBitmap;
 }
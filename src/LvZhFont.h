@@ -21,6 +21,7 @@ public:
     static bool begin();
     static lv_font_t* getFont() { return &fontDescriptor; }
     static bool isInitialized() { return initialized; }
+    static int prefetch(const char* text) { return initialized ? XFontAdapter::instance.prefetch(text) : 0; }
     static unsigned int getStatGetGlyphDsc() { return statGetGlyphDsc; }
     static unsigned int getStatGetGlyphBitmapLv() { return statGetGlyphBitmapLv; }
     static void resetStats() { statGetGlyphDsc = 0; statGetGlyphBitmapLv = 0; }
@@ -0,0 +1,40 @@
+#include "PerfGovernor.h"
+
+perf_gov_decision_t perf_gov_default_policy(const perf_gov_input_t& in) {
+    if (in.powerState == POWER_STATE_SLEEP) {
+        return {PERF_GOV_SLEEP_MS, PERF_GOV_SLEEP};
+    }
+    if (in.sinceInputMs < PERF_GOV_INPUT_MS) {
+        return {PERF_GOV_FAST_MS, PERF_GOV_INPUT};
+    }
+    if (in.animations > 0) {
+        return {PERF_GOV_FAST_MS, PERF_GOV_ANIM};
+    }
+    if (in.powerState == POWER_STATE_IDLE) {
+        return {PERF_GOV_IDLE_MS, PERF_GOV_IDLE};
+    }
+    if (in.dirtyPxPerFrame >= PERF_GOV_DIRTY_PX) {
+        return {PERF_GOV_FAST_MS, PERF_GOV_DIRTY};
+    }
+    return {PERF_GOV_QUIET_MS, PERF_GOV_QUIET};
+}
+
+bool perf_gov_step(perf_gov_state_t& st, const perf_gov_decision_t& d, uint32_t nowMs) {
+    if (d.periodMs > st.periodMs) {
+        if (!st.slowing) {
+            st.slowing = true;
+            st.slowingSinceMs = nowMs;
+        }
+        if (nowMs - st.slowingSinceMs < PERF_GOV_HOLD_MS) {
+            return false;
+        }
+    }
+    st.slowing = false;
+    
+    if (d.periodMs == st.periodMs && d.reason == st.reason) {
+        return false;
+    }
+    st.periodMs = d.periodMs;
+    st.reason = d.reason;
+    return true;
+}
@@ -0,0 +1,63 @@
+#ifndef PERF_GOVERNOR_H
+#define PERF_GOVERNOR_H
+
+#include <stdint.h>
+#include "PowerState.h"
+
+// Display refresh governor: picks the LVGL refresh period from input,
+// animation, redraw and power activity. Plain C++ with no Arduino or LVGL
+// headers, so the native test env builds it; PerformanceManager feeds it
+// on the LVGL task.
+
+#define PERF_GOV_FAST_MS        16      // LV_DISP_DEF_REFR_PERIOD
+#define PERF_GOV_QUIET_MS       33
+#define PERF_GOV_IDLE_MS        66
+#define PERF_GOV_SLEEP_MS       200
+#define PERF_GOV_INPUT_MS       500     // stay fast this long after the finger lifts
+#define PERF_GOV_PANEL_PX       (320 * 240)
+#define PERF_GOV_DIRTY_PX       (PERF_GOV_PANEL_PX / 4)
+#define PERF_GOV_HOLD_MS        300     // a slower cadence must be proposed this long
+
+typedef enum {
+    PERF_GOV_INPUT = 0,         // finger down or just lifted (drag, fling)
+    PERF_GOV_ANIM,              // animations running
+    PERF_GOV_DIRTY,             // large areas redrawn without input
+    PERF_GOV_QUIET,             // small updates only
+    PERF_GOV_IDLE,              // PowerManager idle
+    PERF_GOV_SLEEP,             // PowerManager sleep, backlight off
+    PERF_GOV_REASON_COUNT
+} perf_gov_reason_t;
+
+// What the refresh governor sees on each LVGL task pass
+typedef struct {
+    uint32_t sinceInputMs;
+    uint32_t dirtyPxPerFrame;   // recent average, 0 once frames stop
+    uint16_t animations;
+    power_state_t powerState;
+} perf_gov_input_t;
+
+typedef struct {
+    uint32_t periodMs;
+    perf_gov_reason_t reason;
+} perf_gov_decision_t;
+
+// Pure function of its input, so policies can be replayed against traces
+typedef perf_gov_decision_t (*perf_gov_policy_t)(const perf_gov_input_t& in);
+
+// Period in effect plus the hold timer for a pending slow-down
+typedef struct {
+    uint32_t periodMs;
+    perf_gov_reason_t reason;
+    bool slowing;
+    uint32_t slowingSinceMs;
+} perf_gov_state_t;
+
+perf_gov_decision_t perf_gov_default_policy(const perf_gov_input_t& in);
+
+// Applies a policy decision made at nowMs. Speeding up applies at once;
+// slowing down waits PERF_GOV_HOLD_MS so a brief lull between touch reads
+// or animation steps does not flip the cadence. Returns true when the
+// period or reason changed.
+bool perf_gov_step(perf_gov_state_t& st, const perf_gov_decision_t& d, uint32_t nowMs);
+
+#endif
@@ -6,18 +6,71 @@
 
 PerformanceManager Perf;
 
-static volatile uint32_t tickCounter = 0;
 static volatile bool lvglTaskRunning = false;
 
+// A frame this long after a touch is no longer considered its response
+#define PERF_INPUT_LATENCY_MAX_US  500000
+
+// The governor is built without lv_conf.h and BSP.h
+static_assert(PERF_GOV_FAST_MS == LV_DISP_DEF_REFR_PERIOD, "PERF_GOV_FAST_MS out of sync with lv_conf.h");
+static_assert(PERF_GOV_PANEL_PX == BSP_DISPLAY_WIDTH * BSP_DISPLAY_HEIGHT, "PERF_GOV_PANEL_PX out of sync with BSP.h");
+
+static const char* govReasonNames[PERF_GOV_REASON_COUNT] = {
+    "input", "anim", "dirty", "quiet", "idle", "sleep"
+};
+
+static const uint16_t histEdgesMs[PERF_HIST_BUCKETS - 1] = {2, 4, 8, 16, 33, 66, 133};
+
+static void histAdd(perf_hist_t& hist, uint32_t us) {
+    uint32_t ms = us / 1000;
+    int i = 0;
+    while (i < PERF_HIST_BUCKETS - 1 && ms >= histEdgesMs[i]) {
+        i++;
+    }
+    if (hist.bucket[i] < 0xFFFF) {
+        hist.bucket[i]++;
+    }
+}
+
+static void histPrint(const char* name, const perf_hist_t& hist) {
+    Serial.printf("  %-12s", name);
+    for (int i = 0; i < PERF_HIST_BUCKETS; i++) {
+        if (i < PERF_HIST_BUCKETS - 1) {
+            Serial.printf(" <%u:%u", histEdgesMs[i], hist.bucket[i]);
+        } else {
+            Serial.printf(" >=%u:%u", histEdgesMs[i - 1], hist.bucket[i]);
+        }
+    }
+    Serial.println(" (ms:count)");
+}
+
 PerformanceManager::PerformanceManager() 
     : _initialized(false)
     , _currentMode(PERF_MODE_HIGH)
+    , _frameOpen(false)
+    , _frameStartUs(0)
+    , _frameBlockedUs(0)
+    , _frameRenderUs(0)
+    , _inputPending(false)
+    , _inputUs(0)
+    , _framePixels(0)
+    , _dirtyPxAvg(0)
+    , _lastFrameMs(0)
+    , _govPolicy(perf_gov_default_policy)
+    , _gov{PERF_GOV_FAST_MS, PERF_GOV_QUIET, false, 0}
     , _lvglTaskHandle(nullptr)
-    , _tickTimer(nullptr)
-    , _tickInterval(PERF_TICK_INTERVAL_US)
-    , _refreshInterval(5)
+    , _lvglMutex(nullptr)
+    , _uiHead(0)
+    , _uiTail(0)
 {
     memset(&_stats, 0, sizeof(_stats));
+    memset(&_window, 0, sizeof(_window));
+    portMUX_INITIALIZE(&_statsMux);
+    
+    memset(_uiSlots, 0, sizeof(_uiSlots));
+    for (int i = 0; i < PERF_UI_QUEUE_LEN; i++) {
+        _uiSlots[i].seq = i;
+    }
 }
 
 PerformanceManager::~PerformanceManager() {
@@ -33,12 +86,15 @@ bool PerformanceManager::begin() {
     
     _currentMode = PERF_MODE_HIGH;
     
-    createTickTimer();
+    _lvglMutex = xSemaphoreCreateRecursiveMutex();
+    if (!_lvglMutex) {
+        Serial.println("[Perf] Failed to create LVGL lock!");
+        return false;
+    }
     
     _initialized = true;
     
     Serial.println("[Perf] Performance Manager initialized");
-    Serial.printf("  Tick interval: %d us\n", _tickInterval);
     Serial.printf("  Running on core: %d\n", xPortGetCoreID());
     
     return true;
@@ -50,54 +106,184 @@ void PerformanceManager::end() {
     }
     
     stopLvglTask();
-    destroyTickTimer();
     _initialized = false;
 }
 
-void PerformanceManager::createTickTimer() {
-    const esp_timer_create_args_t timerArgs = {
-        .callback = tickTimerCallback,
-        .arg = this,
-        .dispatch_method = ESP_TIMER_TASK,
-        .name = "lvgl_tick"
-    };
+// LVGL ticks come from millis(), so the task only has to run when a timer
+// is due. It sleeps for what lv_timer_handler() returns and is woken early
+// by touch, by other tasks that changed the UI, or on shutdown.
+void PerformanceManager::lvglTaskEntry(void* arg) {
+    PerformanceManager* perf = (PerformanceManager*)arg;
     
-    esp_err_t err = esp_timer_create(&timerArgs, &_tickTimer);
-    if (err != ESP_OK) {
-        Serial.println("[Perf] Failed to create tick timer!");
-        return;
+    Serial.println("[Perf] LVGL task started on Core 1");
+    
+    lvglTaskRunning = true;
+    
+    while (lvglTaskRunning) {
+        perf->lockLvgl();
+        bsp_touch_poll_irq();
+        perf->drainUi();
+        uint32_t next = lv_timer_handler();
+        // Finish the frame's last stripe now rather than at the next refresh
+        bsp_display_flush_poll(true);
+        perf->runGovernor();
+        perf->unlockLvgl();
+        
+        if (next > PERF_MAX_SLEEP_MS) next = PERF_MAX_SLEEP_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(next));
+        
+        portENTER_CRITICAL(&perf->_statsMux);
+        perf->_window.wakeups++;
+        portEXIT_CRITICAL(&perf->_statsMux);
     }
     
-    esp_timer_start_periodic(_tickTimer, _tickInterval);
-    Serial.println("[Perf] Tick timer started (1ms period)");
+    Serial.println("[Perf] LVGL task stopped");
+    vTaskDelete(NULL);
 }
 
-void PerformanceManager::destroyTickTimer() {
-    if (_tickTimer) {
-        esp_timer_stop(_tickTimer);
-        esp_timer_delete(_tickTimer);
-        _tickTimer = nullptr;
+void PerformanceManager::wake() {
+    if (_lvglTaskHandle) {
+        xTaskNotifyGive(_lvglTaskHandle);
     }
 }
 
-void IRAM_ATTR PerformanceManager::tickTimerCallback(void* arg) {
-    tickCounter++;
+void IRAM_ATTR PerformanceManager::wakeFromISR() {
+    if (_lvglTaskHandle) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(_lvglTaskHandle, &woken);
+        if (woken) {
+            portYIELD_FROM_ISR();
+        }
+    }
 }
 
-void PerformanceManager::lvglTaskEntry(void* arg) {
-    PerformanceManager* perf = (PerformanceManager*)arg;
+bool PerformanceManager::lockLvgl(uint32_t timeoutMs) {
+    if (!_lvglMutex) {
+        // Before begin() only setup() touches LVGL
+        return true;
+    }
     
-    Serial.println("[Perf] LVGL task started on Core 1");
+    if (xSemaphoreTakeRecursive(_lvglMutex, 0) == pdTRUE) {
+        portENTER_CRITICAL(&_statsMux);
+        _window.lockTakes++;
+        portEXIT_CRITICAL(&_statsMux);
+        return true;
+    }
     
-    lvglTaskRunning = true;
+    uint32_t start = micros();
+    TickType_t ticks = timeoutMs == PERF_LOCK_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    bool ok = xSemaphoreTakeRecursive(_lvglMutex, ticks) == pdTRUE;
+    uint32_t waited = micros() - start;
     
-    while (lvglTaskRunning) {
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(perf->_refreshInterval));
+    portENTER_CRITICAL(&_statsMux);
+    if (ok) {
+        _window.lockTakes++;
+        _window.lockContended++;
+    } else {
+        _window.lockTimeouts++;
+    }
+    _window.lockWaitUs += waited;
+    if (waited > _window.lockWaitWorstUs) {
+        _window.lockWaitWorstUs = waited;
+    }
+    portEXIT_CRITICAL(&_statsMux);
+    return ok;
+}
+
+void PerformanceManager::unlockLvgl() {
+    if (_lvglMutex) {
+        xSemaphoreGiveRecursive(_lvglMutex);
+    }
+}
+
+bool PerformanceManager::postUi(perf_ui_fn_t fn, void* ctx, const void* data, size_t len) {
+    if (!fn || len > PERF_UI_DATA_MAX) {
+        return false;
     }
     
-    Serial.println("[Perf] LVGL task stopped");
-    vTaskDelete(NULL);
+    perf_ui_slot_t* slot;
+    uint32_t pos = __atomic_load_n(&_uiHead, __ATOMIC_RELAXED);
+    while (true) {
+        slot = &_uiSlots[pos & (PERF_UI_QUEUE_LEN - 1)];
+        uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            // On failure pos is reloaded with the current head
+            if (__atomic_compare_exchange_n(&_uiHead, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Slot still holds a command from the previous lap
+            portENTER_CRITICAL(&_statsMux);
+            _window.uiDropped++;
+            portEXIT_CRITICAL(&_statsMux);
+            return false;
+        } else {
+            pos = __atomic_load_n(&_uiHead, __ATOMIC_RELAXED);
+        }
+    }
+    
+    slot->fn = fn;
+    slot->ctx = ctx;
+    if (len) {
+        memcpy(slot->data, data, len);
+    }
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+    
+    wake();
+    return true;
+}
+
+// Called with the LVGL lock held. Each slot is released before its command
+// runs, so a command may post again; one pass runs at most a full queue.
+void PerformanceManager::drainUi() {
+    uint32_t ran = 0;
+    uint8_t data[PERF_UI_DATA_MAX];
+    
+    for (int n = 0; n < PERF_UI_QUEUE_LEN; n++) {
+        perf_ui_slot_t* slot = &_uiSlots[_uiTail & (PERF_UI_QUEUE_LEN - 1)];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != _uiTail + 1) {
+            break;
+        }
+        
+        perf_ui_fn_t fn = slot->fn;
+        void* ctx = slot->ctx;
+        memcpy(data, slot->data, sizeof(data));
+        __atomic_store_n(&slot->seq, _uiTail + PERF_UI_QUEUE_LEN, __ATOMIC_RELEASE);
+        _uiTail++;
+        
+        if (fn) {
+            fn(ctx, data);
+            ran++;
+        }
+    }
+    
+    if (ran) {
+        portENTER_CRITICAL(&_statsMux);
+        _window.uiCommands += ran;
+        portEXIT_CRITICAL(&_statsMux);
+    }
+}
+
+// Only published slots are touched, and only the lock holder reads them.
+// A post still in progress for ctx is not seen, so stop its producer first.
+void PerformanceManager::cancelUi(void* ctx) {
+    LvglLock lock;
+    uint32_t head = __atomic_load_n(&_uiHead, __ATOMIC_ACQUIRE);
+    for (uint32_t pos = _uiTail; pos != head; pos++) {
+        perf_ui_slot_t* slot = &_uiSlots[pos & (PERF_UI_QUEUE_LEN - 1)];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) == pos + 1 && slot->ctx == ctx) {
+            slot->fn = nullptr;
+        }
+    }
+}
+
+void PerformanceManager::wakeIfDirty() {
+    lv_disp_t* disp = lv_disp_get_default();
+    if (disp && disp->inv_p > 0) {
+        wake();
+    }
 }
 
 void PerformanceManager::startLvglTask() {
@@ -132,6 +318,7 @@ void PerformanceManager::stopLvglTask() {
     }
     
     lvglTaskRunning = false;
+    wake();
     vTaskDelay(pdMS_TO_TICKS(50));
     _lvglTaskHandle = nullptr;
 }
@@ -155,58 +342,218 @@ void PerformanceManager::setMode(perf_mode_t mode) {
     }
 }
 
+void PerformanceManager::frameBegin(uint16_t areas, uint16_t merged, uint32_t dirtyPx, uint32_t overdrawPx) {
+    _frameOpen = true;
+    _framePixels = 0;
+    _frameStartUs = micros();
+    _frameBlockedUs = 0;
+    _frameRenderUs = 0;
+    
+    portENTER_CRITICAL(&_statsMux);
+    _window.areas += areas;
+    _window.areasMerged += merged;
+    _window.dirtyPx += dirtyPx;
+    _window.overdrawPx += overdrawPx;
+    portEXIT_CRITICAL(&_statsMux);
+}
+
+void PerformanceManager::flushBegin() {
+    if (_frameOpen) {
+        _frameRenderUs = micros() - _frameStartUs - _frameBlockedUs;
+    }
+}
+
+void PerformanceManager::flushBlocked(uint32_t us) {
+    _frameBlockedUs += us;
+}
+
+void PerformanceManager::inputEvent(uint32_t irqUs) {
+    if (!_inputPending) {
+        _inputPending = true;
+        _inputUs = irqUs;
+    }
+}
+
+void PerformanceManager::flushEnd(uint32_t busyUs, uint32_t pixels, uint16_t windows, uint32_t bytes, bool last) {
+    uint32_t now = micros();
+    uint32_t frameUs = now - _frameStartUs;
+    bool frameDone = last && _frameOpen;
+    uint32_t inputUs = 0;
+    bool inputDone = false;
+    _framePixels += pixels;
+    if (frameDone) {
+        _frameOpen = false;
+        _dirtyPxAvg = (_dirtyPxAvg * 3 + _framePixels) / 4;
+        _lastFrameMs = millis();
+        if (_inputPending) {
+            _inputPending = false;
+            inputUs = now - _inputUs;
+            inputDone = inputUs <= PERF_INPUT_LATENCY_MAX_US;
+        }
+    }
+    
+    portENTER_CRITICAL(&_statsMux);
+    _window.flushUs += busyUs;
+    _window.pixels += pixels;
+    _window.bytes += bytes;
+    _window.flushes++;
+    _window.windows += windows;
+    histAdd(_window.flushHist, busyUs);
+    if (frameDone) {
+        _window.frames++;
+        _window.renderUs += _frameRenderUs;
+        histAdd(_window.renderHist, _frameRenderUs);
+        if (frameUs > _window.worstUs) {
+            _window.worstUs = frameUs;
+        }
+    }
+    if (inputDone) {
+        _window.inputs++;
+        _window.inputUs += inputUs;
+        if (inputUs > _window.inputWorstUs) {
+            _window.inputWorstUs = inputUs;
+        }
+    }
+    portEXIT_CRITICAL(&_statsMux);
+    
+    if (frameDone) {
+        rollWindow(millis());
+    }
+}
+
+void PerformanceManager::rollWindow(uint32_t nowMs) {
+    portENTER_CRITICAL(&_statsMux);
+    uint32_t elapsed = nowMs - _window.startMs;
+    if (elapsed >= PERF_STATS_WINDOW_MS) {
+        uint32_t frames = _window.frames;
+        _stats.fps = frames * 1000 / elapsed;
+        _stats.cpuUsage = _window.renderUs / 10 / elapsed;
+        _stats.renderAvgUs = frames ? _window.renderUs / frames : 0;
+        _stats.flushAvgUs = frames ? _window.flushUs / frames : 0;
+        _stats.pixelsPerFrame = frames ? _window.pixels / frames : 0;
+        _stats.spiBytesPerFrame = frames ? _window.bytes / frames : 0;
+        _stats.areas = _window.areas;
+        _stats.areasMerged = _window.areasMerged;
+        _stats.overdrawPct = _window.dirtyPx ? (uint64_t)_window.overdrawPx * 100 / _window.dirtyPx : 0;
+        _stats.flushes = _window.flushes;
+        _stats.addrWindows = _window.windows;
+        _stats.frameWorstUs = _window.worstUs;
+        _stats.wakeups = _window.wakeups * 1000 / elapsed;
+        _stats.governorChanges = _window.govChanges;
+        if (_window.inputs) {
+            _stats.inputLatencyUs = _window.inputUs / _window.inputs;
+            _stats.inputLatencyWorstUs = _window.inputWorstUs;
+        }
+        _stats.lockTakes = _window.lockTakes;
+        _stats.lockContended = _window.lockContended;
+        _stats.lockWaitUs = _window.lockWaitUs;
+        _stats.lockWaitWorstUs = _window.lockWaitWorstUs;
+        _stats.lockTimeouts = _window.lockTimeouts;
+        _stats.uiCommands = _window.uiCommands;
+        _stats.uiDropped = _window.uiDropped;
+        _stats.renderHist = _window.renderHist;
+        _stats.flushHist = _window.flushHist;
+        
+        memset(&_window, 0, sizeof(_window));
+        _window.startMs = nowMs;
+    }
+    portEXIT_CRITICAL(&_statsMux);
+}
+
 void PerformanceManager::updateStats() {
-    _stats.tickCount = tickCounter;
-    _stats.freeHeap = ESP.getFreeHeap();
-    _stats.currentMode = _currentMode;
+    uint32_t freeHeap = ESP.getFreeHeap();
     
-#if LV_USE_MEM_MONITOR
     lv_mem_monitor_t mem_mon;
-    lv_mem_monitor(&mem_mon);
+    {
+        LvglLock lock;
+        lv_mem_monitor(&mem_mon);
+    }
+
+    portENTER_CRITICAL(&_statsMux);
+    _stats.freeHeap = freeHeap;
+    _stats.currentMode = _currentMode;
+    _stats.refreshPeriodMs = _gov.periodMs;
+    _stats.governorReason = _gov.reason;
     _stats.lvglMemUsed = mem_mon.total_size - mem_mon.free_size;
     _stats.lvglMemFree = mem_mon.free_size;
-    _stats.cpuUsage = mem_mon.used_pct;
-#endif
+    _stats.lvglMemUsedPct = mem_mon.used_pct;
+    portEXIT_CRITICAL(&_statsMux);
 
-    _stats.fps = 0;
+    // Publishes an idle window too, so FPS drops to 0 when nothing redraws
+    rollWindow(millis());
 }
 
 perf_stats_t PerformanceManager::getStats() {
     updateStats();
-    return _stats;
+    
+    perf_stats_t stats;
+    portENTER_CRITICAL(&_statsMux);
+    stats = _stats;
+    portEXIT_CRITICAL(&_statsMux);
+    return stats;
 }
 
 void PerformanceManager::printStats() {
-    updateStats();
+    perf_stats_t stats = getStats();
     
     Serial.println("\n[Perf] Performance Statistics");
     Serial.println("------------------------------");
     Serial.printf("  CPU Freq:    %d MHz\n", getCpuFrequencyMhz());
-    Serial.printf("  Free Heap:   %u bytes\n", _stats.freeHeap);
-    Serial.printf("  Tick Count:  %u\n", _stats.tickCount);
+    Serial.printf("  Free Heap:   %u bytes\n", stats.freeHeap);
+    Serial.printf("  Wakeups:     %u /s\n", stats.wakeups);
+    Serial.printf("  Refresh:     %u ms (%s), %u changes\n", stats.refreshPeriodMs,
+        govReasonNames[stats.governorReason], stats.governorChanges);
     
-#if LV_USE_MEM_MONITOR
-    Serial.printf("  LVGL Used:   %u bytes\n", _stats.lvglMemUsed);
-    Serial.printf("  LVGL Free:   %u bytes\n", _stats.lvglMemFree);
-    Serial.printf("  LVGL Usage:  %d%%\n", _stats.cpuUsage);
-#endif
+    Serial.printf("  LVGL Used:   %u bytes\n", stats.lvglMemUsed);
+    Serial.printf("  LVGL Free:   %u bytes\n", stats.lvglMemFree);
+    Serial.printf("  LVGL Usage:  %d%%\n", stats.lvglMemUsedPct);
 
-#if LV_USE_PERF_MONITOR
-    Serial.printf("  FPS:         %u\n", _stats.fps);
-#endif
+    Serial.printf("  FPS:         %u\n", stats.fps);
+    Serial.printf("  Render:      %u us/frame (%u%% CPU)\n", stats.renderAvgUs, stats.cpuUsage);
+    Serial.printf("  Flush:       %u us/frame, %u px/frame\n", stats.flushAvgUs, stats.pixelsPerFrame);
+    Serial.printf("  SPI:         %u bytes/frame, %u flushes, %u windows\n",
+        stats.spiBytesPerFrame, stats.flushes, stats.addrWindows);
+    Serial.printf("  Areas:       %u (%u merged, %u%% overdraw)\n",
+        stats.areas, stats.areasMerged, stats.overdrawPct);
+    Serial.printf("  Worst frame: %u us\n", stats.frameWorstUs);
+    Serial.printf("  Touch->panel: %u us avg, %u us worst\n", stats.inputLatencyUs, stats.inputLatencyWorstUs);
+    Serial.printf("  LVGL lock:   %u takes, %u waited, %u us total, %u us worst, %u timeouts\n",
+        stats.lockTakes, stats.lockContended, stats.lockWaitUs, stats.lockWaitWorstUs, stats.lockTimeouts);
+    Serial.printf("  UI queue:    %u run, %u dropped\n", stats.uiCommands, stats.uiDropped);
+    histPrint("Render hist:", stats.renderHist);
+    histPrint("Flush hist:", stats.flushHist);
     
     Serial.println("------------------------------\n");
 }
 
-void PerformanceManager::setTickInterval(uint32_t intervalUs) {
-    _tickInterval = intervalUs;
-    
-    if (_tickTimer && _initialized) {
-        esp_timer_stop(_tickTimer);
-        esp_timer_start_periodic(_tickTimer, _tickInterval);
-    }
+void PerformanceManager::setGovernorPolicy(perf_gov_policy_t policy) {
+    _govPolicy = policy ? policy : perf_gov_default_policy;
 }
 
-void PerformanceManager::setRefreshInterval(uint32_t intervalMs) {
-    _refreshInterval = intervalMs;
+// Runs on the LVGL task after each lv_timer_handler() pass
+void PerformanceManager::runGovernor() {
+    uint32_t now = millis();
+    
+    perf_gov_input_t in;
+    in.sinceInputMs = now - Power.getStatus().lastActivityMs;
+    in.dirtyPxPerFrame = now - _lastFrameMs < PERF_GOV_HOLD_MS ? _dirtyPxAvg : 0;
+    in.animations = lv_anim_count_running();
+    in.powerState = Power.getState();
+    
+    perf_gov_decision_t d = _govPolicy(in);
+    
+    portENTER_CRITICAL(&_statsMux);
+    uint32_t oldPeriodMs = _gov.periodMs;
+    perf_gov_step(_gov, d, now);
+    if (_gov.periodMs != oldPeriodMs) {
+        _window.govChanges++;
+    }
+    portEXIT_CRITICAL(&_statsMux);
+    
+    if (_gov.periodMs != oldPeriodMs) {
+        lv_disp_t* disp = lv_disp_get_default();
+        if (disp) {
+            lv_timer_set_period(_lv_disp_get_refr_timer(disp), _gov.periodMs);
+        }
+    }
 }
@@ -4,12 +4,21 @@
 #include <Arduino.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <esp_timer.h>
+#include <freertos/semphr.h>
 #include <esp_pm.h>
+#include "PowerManager.h"
+#include "PerfGovernor.h"
 
 #define PERF_TASK_STACK_SIZE    8192
 #define PERF_TASK_PRIORITY      5
-#define PERF_TICK_INTERVAL_US   1000
+#define PERF_MAX_SLEEP_MS       1000
+
+#define PERF_STATS_WINDOW_MS    1000
+#define PERF_HIST_BUCKETS       8
+
+#define PERF_LOCK_FOREVER       0xFFFFFFFF
+#define PERF_UI_QUEUE_LEN       32      // power of two
+#define PERF_UI_DATA_MAX        48      // payload copied into each UI command
 
 typedef enum {
     PERF_MODE_HIGH = 0,
@@ -17,14 +26,51 @@ typedef enum {
     PERF_MODE_LOW = 2
 } perf_mode_t;
 
+// UI command, run on the LVGL task with the LVGL lock held. data points to
+// the copy of the payload given to postUi() and is only valid during the call.
+typedef void (*perf_ui_fn_t)(void* ctx, const void* data);
+
+// Counts per duration bucket: <2, <4, <8, <16, <33, <66, <133, >=133 ms
+typedef struct {
+    uint16_t bucket[PERF_HIST_BUCKETS];
+} perf_hist_t;
+
+// Frame figures cover the last completed PERF_STATS_WINDOW_MS window.
+// A frame runs from LVGL's render start until its last stripe is on the
+// panel; render time excludes the time LVGL spent waiting on the bus.
 typedef struct {
     uint32_t fps;
-    uint32_t cpuUsage;
+    uint32_t cpuUsage;          // share of the window spent rendering, %
     uint32_t freeHeap;
     uint32_t lvglMemUsed;
     uint32_t lvglMemFree;
+    uint32_t lvglMemUsedPct;
     perf_mode_t currentMode;
-    uint32_t tickCount;
+    uint32_t wakeups;           // LVGL task wakeups per second
+    uint32_t inputLatencyUs;    // touch IRQ until the next frame is on the panel
+    uint32_t inputLatencyWorstUs;
+    uint32_t refreshPeriodMs;   // current display refresh period
+    perf_gov_reason_t governorReason;
+    uint32_t governorChanges;   // period changes in the last window
+    uint32_t renderAvgUs;
+    uint32_t flushAvgUs;        // bus time per frame
+    uint32_t frameWorstUs;
+    uint32_t pixelsPerFrame;    // pixels actually sent to the panel
+    uint32_t spiBytesPerFrame;  // pixel data plus address window commands
+    uint32_t areas;             // invalid areas rendered in the last window
+    uint32_t areasMerged;       // of those, folded in under the overdraw budget
+    uint32_t overdrawPct;       // clean pixels redrawn by merging, % of dirty ones
+    uint32_t flushes;           // flush callbacks (render stripes)
+    uint32_t addrWindows;       // address windows set on the panel
+    perf_hist_t renderHist;     // per frame
+    perf_hist_t flushHist;      // per transfer
+    uint32_t lockTakes;         // LVGL lock acquisitions in the last window
+    uint32_t lockContended;     // of which had to wait for another task
+    uint32_t lockWaitUs;        // total wait in the last window
+    uint32_t lockWaitWorstUs;
+    uint32_t lockTimeouts;
+    uint32_t uiCommands;        // queued UI commands run in the last window
+    uint32_t uiDropped;         // posts rejected because the queue was full
 } perf_stats_t;
 
 class PerformanceManager {
@@ -47,28 +93,121 @@ public:
     uint32_t getFPS() { return _stats.fps; }
     uint32_t getFreeHeap() { return _stats.freeHeap; }
     
-    void setTickInterval(uint32_t intervalUs);
-    void setRefreshInterval(uint32_t intervalMs);
-    uint32_t getRefreshInterval() { return _refreshInterval; }
+    uint32_t getRefreshInterval() { return _gov.periodMs; }
+    
+    // nullptr restores perf_gov_default_policy
+    void setGovernorPolicy(perf_gov_policy_t policy);
+    
+    // Frame instrumentation, called from the display driver on the LVGL task
+    void frameBegin(uint16_t areas, uint16_t merged, uint32_t dirtyPx, uint32_t overdrawPx);
+    void flushBegin();
+    void flushBlocked(uint32_t us);
+    void flushEnd(uint32_t busyUs, uint32_t pixels, uint16_t windows, uint32_t bytes, bool last);
+    void inputEvent(uint32_t irqUs);
+    
+    // Wake the LVGL task before its next timer is due
+    void wake();
+    void wakeFromISR();
+    void wakeIfDirty();
+    
+    // LVGL is not thread safe. Any task other than the LVGL task must hold
+    // this recursive lock around LVGL calls; timeoutMs bounds the wait.
+    bool lockLvgl(uint32_t timeoutMs = PERF_LOCK_FOREVER);
+    void unlockLvgl();
+    
+    // Queue fn(ctx, copy of data) to run on the LVGL task. Lock free, safe
+    // from any task (not from ISRs); returns false when the queue is full.
+    bool postUi(perf_ui_fn_t fn, void* ctx, const void* data = nullptr, size_t len = 0);
+    // Drop queued commands for ctx before it is freed
+    void cancelUi(void* ctx);
     
     static void lvglTaskEntry(void* arg);
-    static void tickTimerCallback(void* arg);
     
 private:
+    typedef struct {
+        uint32_t startMs;
+        uint32_t frames;
+        uint32_t renderUs;
+        uint32_t flushUs;
+        uint32_t worstUs;
+        uint32_t pixels;
+        uint32_t bytes;
+        uint32_t areas;
+        uint32_t areasMerged;
+        uint32_t dirtyPx;
+        uint32_t overdrawPx;
+        uint32_t flushes;
+        uint32_t windows;
+        uint32_t wakeups;
+        uint32_t inputs;
+        uint32_t inputUs;
+        uint32_t inputWorstUs;
+        uint32_t govChanges;
+        uint32_t lockTakes;
+        uint32_t lockContended;
+        uint32_t lockWaitUs;
+        uint32_t lockWaitWorstUs;
+        uint32_t lockTimeouts;
+        uint32_t uiCommands;
+        uint32_t uiDropped;
+        perf_hist_t renderHist;
+        perf_hist_t flushHist;
+    } perf_window_t;
+    
+    // Bounded MPSC ring: producers claim a slot by CAS on _uiHead and publish
+    // it by advancing seq; the LVGL lock holder is the only consumer.
+    typedef struct {
+        uint32_t seq;
+        perf_ui_fn_t fn;
+        void* ctx;
+        uint8_t data[PERF_UI_DATA_MAX];
+    } perf_ui_slot_t;
+    
     bool _initialized;
     perf_mode_t _currentMode;
     perf_stats_t _stats;
+    portMUX_TYPE _statsMux;
+    perf_window_t _window;
+    
+    bool _frameOpen;
+    uint32_t _frameStartUs;
+    uint32_t _frameBlockedUs;
+    uint32_t _frameRenderUs;
+    bool _inputPending;
+    uint32_t _inputUs;
+    uint32_t _framePixels;
+    uint32_t _dirtyPxAvg;
+    uint32_t _lastFrameMs;
+    
+    perf_gov_policy_t _govPolicy;
+    perf_gov_state_t _gov;
     
     TaskHandle_t _lvglTaskHandle;
-    esp_timer_handle_t _tickTimer;
-    uint32_t _tickInterval;
-    volatile uint32_t _refreshInterval;
+    SemaphoreHandle_t _lvglMutex;
+    
+    perf_ui_slot_t _uiSlots[PERF_UI_QUEUE_LEN];
+    uint32_t _uiHead;
+    uint32_t _uiTail;
     
     void updateStats();
-    void createTickTimer();
-    void destroyTickTimer();
+    void drainUi();
+    void rollWindow(uint32_t nowMs);
+    void runGovernor();
 };
 
 extern PerformanceManager Perf;
 
+// Holds the LVGL lock for the enclosing scope
+class LvglLock {
+public:
+    explicit LvglLock(uint32_t timeoutMs = PERF_LOCK_FOREVER) { _locked = Perf.lockLvgl(timeoutMs); }
+    ~LvglLock() { if (_locked) Perf.unlockLvgl(); }
+    bool locked() const { return _locked; }
+    
+private:
+    bool _locked;
+    LvglLock(const LvglLock&);
+    LvglLock& operator=(const LvglLock&);
+};
+
 #endif
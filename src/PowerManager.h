@@ -5,6 +5,7 @@
 #include <esp_sleep.h>
 #include <esp_pm.h>
 #include <driver/adc.h>
+#include "PowerState.h"
 
 #define POWER_BOOT_PIN          0
 #define POWER_LDR_PIN           34
@@ -32,12 +33,6 @@ typedef enum {
     BACKLIGHT_MODE_OFF = 2
 } backlight_mode_t;
 
-typedef enum {
-    POWER_STATE_ACTIVE = 0,
-    POWER_STATE_IDLE = 1,
-    POWER_STATE_SLEEP = 2
-} power_state_t;
-
 typedef struct {
     power_cpu_mode_t cpuMode;
     backlight_mode_t backlightMode;
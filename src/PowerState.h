@@ -0,0 +1,12 @@
+#ifndef POWER_STATE_H
+#define POWER_STATE_H
+
+// PowerManager's activity state, on its own so Arduino-free code such as
+// the refresh governor can use it
+typedef enum {
+    POWER_STATE_ACTIVE = 0,
+    POWER_STATE_IDLE = 1,
+    POWER_STATE_SLEEP = 2
+} power_state_t;
+
+#endif
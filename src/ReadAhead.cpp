@@ -0,0 +1,78 @@
+#include "ReadAhead.h"
+#include <stdlib.h>
+#include <string.h>
+
+ReadAhead::ReadAhead() : buf(NULL), bufStart(0), bufLen(0), refill(0) {
+}
+
+void ReadAhead::release() {
+    free(buf);
+    buf = NULL;
+    bufLen = 0;
+    refill = 0;
+}
+
+uint32_t ReadAhead::read(uint32_t pos, uint8_t* dst, uint32_t len, uint32_t blockSize,
+                         readahead_device_t device, void* ctx, readahead_stats_t* stats) {
+    uint32_t done = 0;
+    uint32_t deviceReads = stats->deviceReads;
+    stats->reads++;
+    
+    if (bufLen && pos >= bufStart && pos < bufStart + bufLen) {
+        uint32_t n = bufStart + bufLen - pos;
+        if (n > len) n = len;
+        memcpy(dst, buf + (pos - bufStart), n);
+        done = n;
+    }
+    
+    while (done < len) {
+        uint32_t want = len - done;
+        
+        if (want < blockSize && !buf) {
+            buf = (uint8_t*)malloc(blockSize);
+        }
+        
+        // Large reads go straight into the caller's buffer, as does
+        // everything when there is no heap for a block
+        if (want >= blockSize || !buf) {
+            done += device(ctx, pos + done, dst + done, want);
+            stats->deviceReads++;
+            break;
+        }
+        
+        uint32_t size = refill && refill < blockSize ? refill : blockSize;
+        if (size < want) size = want;
+        refill = size < blockSize ? size * 2 : 0;
+        
+        bufStart = pos + done;
+        bufLen = device(ctx, bufStart, buf, size);
+        stats->deviceReads++;
+        
+        uint32_t n = bufLen < want ? bufLen : want;
+        memcpy(dst + done, buf, n);
+        done += n;
+        
+        // Short block: end of file
+        if (bufLen < size) break;
+    }
+    
+    if (stats->deviceReads == deviceReads) {
+        stats->hits++;
+        stats->bytesSaved += done;
+    }
+    return done;
+}
+
+void ReadAhead::seek(uint32_t pos, readahead_stats_t* stats) {
+    if (bufLen && (pos < bufStart || pos > bufStart + bufLen)) {
+        bufLen = 0;
+        refill = READAHEAD_SEEK_BYTES;
+        stats->invalidations++;
+    }
+}
+
+void ReadAhead::written(uint32_t pos, uint32_t len) {
+    if (bufLen && pos < bufStart + bufLen && pos + len > bufStart) {
+        bufLen = 0;
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef READ_AHEAD_H
+#define READ_AHEAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define READAHEAD_SEEK_BYTES    512     // first refill after a seek, one SD sector
+
+typedef struct {
+    uint32_t reads;             // read() calls
+    uint32_t hits;              // read() calls served without the device
+    uint32_t deviceReads;       // device read calls
+    uint32_t bytesSaved;        // bytes served by hits
+    uint32_t invalidations;     // seeks that dropped the block
+} readahead_stats_t;
+
+// Reads len bytes at file offset pos into dst, seeking first if needed.
+// Returns the bytes read, short at end of file.
+typedef uint32_t (*readahead_device_t)(void* ctx, uint32_t pos, uint8_t* dst, uint32_t len);
+
+// Read-ahead block behind one LVGL file handle. Decoders issue many small
+// reads; they are served from a block read ahead of them so each does not
+// cost an SD/SPI transaction. Reads of a block or more go straight to the
+// device.
+//
+// A seek outside the block suggests random access (font glyph lookups), so
+// the refill after it is READAHEAD_SEEK_BYTES and doubles with each refill
+// that follows on sequentially, back up to the full block.
+//
+// Not locked; LVGL only calls the drivers with the LVGL lock held. Plain
+// C++ with no Arduino headers, so the native test env builds it.
+class ReadAhead {
+private:
+    uint8_t* buf;               // allocated on the first small read
+    uint32_t bufStart;          // file offset of buf[0]
+    uint32_t bufLen;
+    uint32_t refill;            // next refill size, 0 for a full block
+
+public:
+    ReadAhead();
+
+    // Reads len bytes at pos, every block blockSize bytes
+    uint32_t read(uint32_t pos, uint8_t* dst, uint32_t len, uint32_t blockSize,
+                  readahead_device_t device, void* ctx, readahead_stats_t* stats);
+    // Drops the block unless pos is inside it or just past its end
+    void seek(uint32_t pos, readahead_stats_t* stats);
+    // Drops the block if len bytes written at pos overlap it
+    void written(uint32_t pos, uint32_t len);
+
+    void forget() { bufLen = 0; refill = 0; }
+    void release();
+    bool hasData() const { return bufLen > 0; }
+    bool hasBuffer() const { return buf != NULL; }
+};
+
+#endif
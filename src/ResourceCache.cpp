@@ -0,0 +1,215 @@
+#include "ResourceCache.h"
+#include <stdlib.h>
+#include <string.h>
+
+ResourceCache::ResourceCache(size_t budgetBytes) {
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        entries[i].path[0] = '\0';
+        entries[i].data = NULL;
+        entries[i].size = 0;
+        entries[i].hash = 0;
+        entries[i].lastAccess = 0;
+        entries[i].refs = 0;
+        entries[i].valid = false;
+        entries[i].stale = false;
+    }
+    for (int i = 0; i < CACHE_HASH_SLOTS; i++) {
+        index[i] = -1;
+    }
+    usedMemory = 0;
+    budget = budgetBytes;
+    accessCounter = 0;
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+    rejects = 0;
+}
+
+ResourceCache::~ResourceCache() {
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        free(entries[i].data);
+    }
+}
+
+// FNV-1a
+uint32_t ResourceCache::hashPath(const char* path) {
+    uint32_t hash = 2166136261u;
+    while (*path) {
+        hash ^= (uint8_t)*path++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int ResourceCache::find(const char* path, uint32_t hash) {
+    uint32_t mask = CACHE_HASH_SLOTS - 1;
+    for (uint32_t i = 0; i < CACHE_HASH_SLOTS; i++) {
+        int entry = index[(hash + i) & mask];
+        if (entry < 0) break;
+        if (entries[entry].hash == hash && strcmp(entries[entry].path, path) == 0) {
+            return entry;
+        }
+    }
+    return -1;
+}
+
+int ResourceCache::lookup(const char* path, uint32_t hash) {
+    int i = find(path, hash);
+    if (i >= 0) {
+        hits++;
+    } else {
+        misses++;
+    }
+    return i;
+}
+
+void ResourceCache::touch(int i) {
+    entries[i].lastAccess = ++accessCounter;
+}
+
+// Unpinned entry with the highest bytes x age, so one large stale image
+// goes before several small ones that are still in use
+int ResourceCache::findVictimEntry() {
+    int victim = -1;
+    uint64_t worst = 0;
+    
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        if (!entries[i].valid || entries[i].refs > 0) continue;
+        uint64_t age = accessCounter - entries[i].lastAccess + 1;
+        uint64_t score = age * entries[i].size;
+        if (victim < 0 || score > worst) {
+            worst = score;
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+int ResourceCache::findFreeEntry() {
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        if (!entries[i].valid) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool ResourceCache::makeRoom(size_t size) {
+    if (size > budget) return false;
+    
+    while (usedMemory + size > budget || findFreeEntry() < 0) {
+        int victim = findVictimEntry();
+        if (victim < 0) {
+            rejects++;
+            return false;
+        }
+        evict(victim);
+        evictions++;
+    }
+    return true;
+}
+
+int ResourceCache::insert(const char* path, uint32_t hash, uint8_t* data, size_t size) {
+    if (!makeRoom(size)) return -1;
+    
+    int i = findFreeEntry();
+    strncpy(entries[i].path, path, sizeof(entries[i].path) - 1);
+    entries[i].path[sizeof(entries[i].path) - 1] = '\0';
+    entries[i].data = data;
+    entries[i].size = size;
+    entries[i].hash = hash;
+    entries[i].lastAccess = ++accessCounter;
+    entries[i].refs = 0;
+    entries[i].valid = true;
+    entries[i].stale = false;
+    usedMemory += size;
+    
+    uint32_t mask = CACHE_HASH_SLOTS - 1;
+    uint32_t slot = hash & mask;
+    while (index[slot] >= 0) {
+        slot = (slot + 1) & mask;
+    }
+    index[slot] = i;
+    return i;
+}
+
+// Removes the entry from the hash index, shifting back later members of
+// its probe run so lookups never need tombstones
+void ResourceCache::unlinkEntry(int i) {
+    uint32_t mask = CACHE_HASH_SLOTS - 1;
+    uint32_t hole = entries[i].hash & mask;
+    while (index[hole] != i) {
+        hole = (hole + 1) & mask;
+    }
+    index[hole] = -1;
+    
+    uint32_t slot = hole;
+    while (true) {
+        slot = (slot + 1) & mask;
+        int entry = index[slot];
+        if (entry < 0) break;
+        uint32_t home = entries[entry].hash & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            index[hole] = entry;
+            index[slot] = -1;
+            hole = slot;
+        }
+    }
+}
+
+void ResourceCache::evict(int i) {
+    if (i < 0 || i >= CACHE_MAX_ENTRIES) return;
+    if (!entries[i].valid || entries[i].refs > 0) return;
+    
+    if (!entries[i].stale) {
+        unlinkEntry(i);
+    }
+    
+    if (entries[i].data) {
+        usedMemory -= entries[i].size;
+        free(entries[i].data);
+        entries[i].data = NULL;
+    }
+    
+    entries[i].path[0] = '\0';
+    entries[i].size = 0;
+    entries[i].lastAccess = 0;
+    entries[i].valid = false;
+    entries[i].stale = false;
+}
+
+void ResourceCache::remove(int i) {
+    if (i < 0 || i >= CACHE_MAX_ENTRIES) return;
+    if (!entries[i].valid || entries[i].stale) return;
+    
+    if (entries[i].refs == 0) {
+        evict(i);
+        return;
+    }
+    unlinkEntry(i);
+    entries[i].stale = true;
+}
+
+// Pinned entries stay; their holders still read them
+void ResourceCache::clear() {
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        evict(i);
+    }
+}
+
+void ResourceCache::pin(int i, CacheHandle* handle) {
+    entries[i].refs++;
+    entries[i].lastAccess = ++accessCounter;
+    handle->data = entries[i].data;
+    handle->size = entries[i].size;
+    handle->entry = i;
+}
+
+void ResourceCache::unpin(int i) {
+    if (entries[i].refs > 0) {
+        entries[i].refs--;
+    }
+    if (entries[i].refs == 0 && entries[i].stale) {
+        evict(i);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CACHE_MAX_ENTRIES       16
+#define CACHE_HASH_SLOTS        32      // power of two, twice the entries
+
+typedef struct {
+    char path[128];
+    uint8_t* data;
+    size_t size;
+    uint32_t hash;
+    uint32_t lastAccess;
+    uint16_t refs;
+    bool valid;
+    bool stale;             // out of the index, freed by its last unpin()
+} CacheEntry;
+
+// A pinned cache entry. data stays valid until the handle is passed to
+// releaseResource(); only unpinned entries are ever evicted.
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    int8_t entry;
+} CacheHandle;
+
+// Resource cache behind StorageManager: entries indexed by path hash
+// (open addressing, linear probing), evicted by size x age within a byte
+// budget. Pinned entries are never evicted.
+//
+// Not locked; StorageManager holds its cache lock around every call. Plain
+// C++ with no Arduino headers, so the native test env builds it.
+class ResourceCache {
+private:
+    CacheEntry entries[CACHE_MAX_ENTRIES];
+    int8_t index[CACHE_HASH_SLOTS];     // entry per hash slot, -1 if empty
+    size_t usedMemory;
+    size_t budget;
+    uint32_t accessCounter;
+    
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t rejects;                   // no room because the rest is pinned
+    
+    int findVictimEntry();
+    int findFreeEntry();
+    void unlinkEntry(int i);
+    
+public:
+    ResourceCache(size_t budgetBytes);
+    ~ResourceCache();
+    
+    static uint32_t hashPath(const char* path);
+    
+    void setBudget(size_t bytes) { budget = bytes; }
+    size_t getBudget() const { return budget; }
+    size_t getUsedMemory() const { return usedMemory; }
+    
+    // Entry index or -1. lookup() counts a hit or miss, find() does not.
+    int find(const char* path, uint32_t hash);
+    int lookup(const char* path, uint32_t hash);
+    void touch(int i);
+    
+    // Evicts unpinned entries until size more bytes and a free entry fit
+    bool makeRoom(size_t size);
+    // Takes ownership of data (malloc'd) on success
+    int insert(const char* path, uint32_t hash, uint8_t* data, size_t size);
+    // Frees the entry unless it is pinned
+    void evict(int i);
+    // Drops the entry from the index, e.g. once its file is rewritten. A
+    // pinned entry keeps its data for the holders and is freed by the last
+    // unpin().
+    void remove(int i);
+    void clear();
+    
+    void pin(int i, CacheHandle* handle);
+    void unpin(int i);
+    
+    const CacheEntry& getEntry(int i) const { return entries[i]; }
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getEvictions() const { return evictions; }
+    uint32_t getRejects() const { return rejects; }
+};
+
+#endif
@@ -1,5 +1,7 @@
 #include "Storage.h"
 #include "ConfigManager.h"
+#include "IOScheduler.h"
+#include "ReadAhead.h"
 #include <ArduinoJson.h>
 
 static lv_fs_drv_t spiffs_drv;
@@ -7,152 +9,504 @@ static lv_fs_drv_t sd_drv;
 
 StorageManager Storage;
 
-static void* spiffs_open_cb(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
-    String fullPath = String("/") + path;
-    fs::File* file = new fs::File(SPIFFS.open(fullPath, "r"));
-    if (!*file) {
-        delete file;
-        return NULL;
+// An LVGL file or directory handle, each with its own read-ahead block.
+//
+// Handles come from a fixed pool. A closed file handle is parked: its
+// fs::File is closed but the path and block are kept, so reopening the same
+// unchanged file (images are often opened twice, once for the header) can
+// start from the block. A read-only open of a file the resource cache holds
+// pins the entry instead and reads from RAM. LVGL only calls the drivers
+// with the LVGL lock held, so the pool needs no lock of its own.
+typedef enum {
+    FILE_SLOT_FREE = 0,
+    FILE_SLOT_OPEN,
+    FILE_SLOT_PARKED
+} file_slot_state_t;
+
+typedef struct {
+    fs::File file;
+    ReadAhead block;
+    CacheHandle cached;         // entry >= 0 when served from the cache
+    uint32_t pos;               // position as LVGL sees it
+    uint32_t filePos;           // position of the underlying file
+    
+    char path[STORAGE_PATH_MAX];
+    char drive;
+    file_slot_state_t state;
+    bool writable;
+    bool isDir;
+    size_t size;                // size and mtime when last opened, to tell
+    time_t lastWrite;           // whether a parked block is still good
+    uint32_t lastUsed;
+} storage_file_t;
+
+typedef struct {
+    readahead_stats_t readAhead;
+    uint32_t opens;
+    uint32_t reopens;           // opens that got back a parked block
+    uint32_t cacheOpens;        // opens served from the resource cache
+    uint32_t poolFull;          // opens refused, every handle in use
+} storage_fs_stats_t;
+
+static uint32_t readAheadSize = STORAGE_READAHEAD_DEFAULT_KB * 1024;
+static storage_fs_stats_t fsStats;
+static storage_file_t* filePool = NULL;
+static uint32_t fileUseCounter = 0;
+
+// LVGL hands over the path after "X:", with or without the leading slash
+static bool formatPath(char* out, const char* path) {
+    int len = snprintf(out, STORAGE_PATH_MAX, "%s%s", path[0] == '/' ? "" : "/", path);
+    return len > 0 && len < STORAGE_PATH_MAX;
+}
+
+// One file operation. The SD card belongs to the IO task, so fileCall()
+// runs card operations there and SPIFFS ones on the calling task.
+typedef enum {
+    FILE_OP_OPEN = 0,
+    FILE_OP_CLOSE,
+    FILE_OP_READ,
+    FILE_OP_WRITE,
+    FILE_OP_NEXT,               // next directory entry into name
+    FILE_OP_EXISTS
+} file_op_kind_t;
+
+#define FILE_OP_NO_SEEK     0xFFFFFFFFUL
+
+typedef struct {
+    file_op_kind_t kind;
+    fs::FS* fs;
+    fs::File* file;
+    const char* path;           // OPEN, EXISTS
+    const char* mode;           // OPEN
+    uint32_t pos;               // READ/WRITE, FILE_OP_NO_SEEK to carry on
+    uint8_t* buf;               // READ/WRITE
+    uint32_t len;
+    char* name;                 // NEXT, STORAGE_PATH_MAX bytes
+    size_t size;                // OPEN result
+    time_t lastWrite;           // OPEN result
+} file_op_t;
+
+static int file_op_io(void* ctx) {
+    file_op_t* op = (file_op_t*)ctx;
+    fs::File* file = op->file;
+    
+    switch (op->kind) {
+        case FILE_OP_OPEN:
+            *file = op->fs->open(op->path, op->mode);
+            if (!*file) return -1;
+            if (file->isDirectory()) return 1;
+            op->size = file->size();
+            op->lastWrite = file->getLastWrite();
+            return 0;
+        
+        case FILE_OP_CLOSE:
+            file->close();
+            *file = fs::File();
+            return 0;
+        
+        case FILE_OP_READ:
+        case FILE_OP_WRITE:
+            if (op->pos != FILE_OP_NO_SEEK) file->seek(op->pos, SeekSet);
+            return op->kind == FILE_OP_READ ? (int)file->read(op->buf, op->len)
+                                            : (int)file->write(op->buf, op->len);
+        
+        case FILE_OP_NEXT: {
+            op->name[0] = '\0';
+            fs::File entry = file->openNextFile();
+            if (!entry) return 0;
+            snprintf(op->name, STORAGE_PATH_MAX, "%s%s", entry.isDirectory() ? "/" : "", entry.name());
+            entry.close();
+            return 1;
+        }
+        
+        case FILE_OP_EXISTS:
+            return op->fs->exists(op->path) ? 1 : 0;
     }
-    return file;
+    return -1;
 }
 
-static lv_fs_res_t spiffs_close_cb(lv_fs_drv_t* drv, void* file_p) {
-    fs::File* file = (fs::File*)file_p;
-    if (file) {
-        file->close();
-        delete file;
+static int fileCall(char drive, file_op_t* op, io_prio_t prio = IO_PRIO_INTERACTIVE) {
+    if (drive != STORAGE_DRIVE_SD) {
+        return file_op_io(op);
     }
-    return LV_FS_RES_OK;
+    // The path keeps the request behind queued writes to the same file
+    const char* path = op->path && strlen(op->path) < IO_PATH_MAX ? op->path : nullptr;
+    return SdIO.run(file_op_io, op, prio, path);
 }
 
-static lv_fs_res_t spiffs_read_cb(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) {
-        *br = 0;
-        return LV_FS_RES_FS_ERR;
+static void closeFile(char drive, fs::File* file, io_prio_t prio = IO_PRIO_INTERACTIVE) {
+    if (!*file) return;
+    file_op_t op = {};
+    op.kind = FILE_OP_CLOSE;
+    op.file = file;
+    fileCall(drive, &op, prio);
+}
+
+static int readFile(char drive, fs::File* file, uint32_t pos, uint8_t* dst, uint32_t len,
+                    io_prio_t prio = IO_PRIO_INTERACTIVE) {
+    file_op_t op = {};
+    op.kind = FILE_OP_READ;
+    op.file = file;
+    op.pos = pos;
+    op.buf = dst;
+    op.len = len;
+    return fileCall(drive, &op, prio);
+}
+
+static bool isOpen(const storage_file_t* f) {
+    return f && (f->file || f->cached.entry >= 0);
+}
+
+static void releaseSlot(storage_file_t* f) {
+    closeFile(f->drive, &f->file);
+    f->block.release();
+    f->path[0] = '\0';
+    f->isDir = false;
+    f->state = FILE_SLOT_FREE;
+}
+
+// Parked handles holding a block are capped; the oldest gives its up
+static void trimParkedBlocks() {
+    while (true) {
+        storage_file_t* oldest = NULL;
+        int count = 0;
+        for (int i = 0; i < STORAGE_FILE_POOL; i++) {
+            storage_file_t* f = &filePool[i];
+            if (f->state != FILE_SLOT_PARKED || !f->block.hasBuffer()) continue;
+            count++;
+            if (!oldest || f->lastUsed < oldest->lastUsed) oldest = f;
+        }
+        if (count <= STORAGE_PARKED_BLOCKS) break;
+        oldest->block.release();
     }
-    *br = file->read((uint8_t*)buf, btr);
-    return LV_FS_RES_OK;
 }
 
-static lv_fs_res_t spiffs_seek_cb(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) return LV_FS_RES_FS_ERR;
+// A parked handle for the same file if there is one, else a free slot,
+// else the least recently used parked one
+static storage_file_t* takeSlot(char drive, const char* path) {
+    storage_file_t* unused = NULL;
+    storage_file_t* parked = NULL;
     
-    SeekMode mode = SeekSet;
-    if (whence == LV_FS_SEEK_CUR) mode = SeekCur;
-    else if (whence == LV_FS_SEEK_END) mode = SeekEnd;
+    for (int i = 0; i < STORAGE_FILE_POOL; i++) {
+        storage_file_t* f = &filePool[i];
+        if (f->state == FILE_SLOT_PARKED && f->drive == drive && strcmp(f->path, path) == 0) {
+            return f;
+        }
+        if (f->state == FILE_SLOT_FREE) {
+            if (!unused) unused = f;
+        } else if (f->state == FILE_SLOT_PARKED) {
+            if (!parked || f->lastUsed < parked->lastUsed) parked = f;
+        }
+    }
     
-    file->seek(pos, mode);
-    return LV_FS_RES_OK;
+    storage_file_t* f = unused ? unused : parked;
+    if (f) {
+        f->path[0] = '\0';
+        f->block.forget();
+    }
+    return f;
 }
 
-static lv_fs_res_t spiffs_tell_cb(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) return LV_FS_RES_FS_ERR;
-    *pos_p = file->position();
-    return LV_FS_RES_OK;
+// Writers make any block read from the old contents stale
+static void forgetPath(char drive, const char* path) {
+    for (int i = 0; i < STORAGE_FILE_POOL; i++) {
+        storage_file_t* f = &filePool[i];
+        if (f->state == FILE_SLOT_PARKED && f->drive == drive && strcmp(f->path, path) == 0) {
+            f->block.forget();
+            f->path[0] = '\0';
+        }
+    }
 }
 
-static void* sd_open_cb(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
-    String fullPath = String("/") + path;
-    fs::File* file = new fs::File(SD.open(fullPath, "r"));
-    if (!*file) {
-        delete file;
+static void* fs_open_cb(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
+    fs::FS* fs = (fs::FS*)drv->user_data;
+    char fullPath[STORAGE_PATH_MAX];
+    if (!filePool || !formatPath(fullPath, path)) return NULL;
+    
+    const char* fsMode = "r";
+    if (mode == LV_FS_MODE_WR) fsMode = "w";
+    else if (mode == (LV_FS_MODE_WR | LV_FS_MODE_RD)) fsMode = "r+";
+    bool writable = (mode & LV_FS_MODE_WR) != 0;
+    
+    char key[STORAGE_PATH_MAX + 2];
+    snprintf(key, sizeof(key), "%c:%s", drv->letter, fullPath);
+    if (writable) {
+        forgetPath(drv->letter, fullPath);
+        Storage.dropResource(key);
+    }
+    
+    storage_file_t* f = takeSlot(drv->letter, fullPath);
+    if (!f) {
+        fsStats.poolFull++;
         return NULL;
     }
-    return file;
+    
+    // Served from RAM. A parked handle for the file keeps its path and
+    // block for the next open that misses the cache.
+    if (!writable && Storage.findResource(key, &f->cached)) {
+        f->drive = drv->letter;
+        f->state = FILE_SLOT_OPEN;
+        f->writable = false;
+        f->isDir = false;
+        f->pos = 0;
+        f->lastUsed = ++fileUseCounter;
+        fsStats.opens++;
+        fsStats.cacheOpens++;
+        return f;
+    }
+    
+    file_op_t op = {};
+    op.kind = FILE_OP_OPEN;
+    op.fs = fs;
+    op.file = &f->file;
+    op.path = fullPath;
+    op.mode = fsMode;
+    f->drive = drv->letter;
+    if (fileCall(drv->letter, &op) != 0) {
+        releaseSlot(f);
+        return NULL;
+    }
+    
+    size_t size = op.size;
+    time_t lastWrite = op.lastWrite;
+    if (f->path[0] && f->block.hasData() && f->size == size && f->lastWrite == lastWrite) {
+        fsStats.reopens++;
+    } else {
+        f->block.forget();
+    }
+    
+    strcpy(f->path, fullPath);
+    f->drive = drv->letter;
+    f->state = FILE_SLOT_OPEN;
+    f->writable = writable;
+    f->isDir = false;
+    f->size = size;
+    f->lastWrite = lastWrite;
+    f->pos = 0;
+    f->filePos = 0;
+    f->lastUsed = ++fileUseCounter;
+    fsStats.opens++;
+    return f;
 }
 
-static lv_fs_res_t sd_close_cb(lv_fs_drv_t* drv, void* file_p) {
-    fs::File* file = (fs::File*)file_p;
-    if (file) {
-        file->close();
-        delete file;
+static lv_fs_res_t fs_close_cb(lv_fs_drv_t* drv, void* file_p) {
+    storage_file_t* f = (storage_file_t*)file_p;
+    if (f && f->cached.entry >= 0) {
+        Storage.releaseResource(&f->cached);
+        f->state = f->path[0] ? FILE_SLOT_PARKED : FILE_SLOT_FREE;
+    } else if (f) {
+        if (f->writable) {
+            // Its mtime may not have moved on yet; don't trust the block
+            releaseSlot(f);
+        } else {
+            closeFile(f->drive, &f->file);
+            f->state = FILE_SLOT_PARKED;
+            trimParkedBlocks();
+        }
     }
     return LV_FS_RES_OK;
 }
 
-static lv_fs_res_t sd_read_cb(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) {
+// Block refills and large reads; on the IO task for the card
+static uint32_t deviceRead(void* ctx, uint32_t pos, uint8_t* dst, uint32_t len) {
+    storage_file_t* f = (storage_file_t*)ctx;
+    int n = readFile(f->drive, &f->file, f->filePos != pos ? pos : FILE_OP_NO_SEEK, dst, len);
+    if (n < 0) n = 0;
+    f->filePos = pos + n;
+    return n;
+}
+
+static lv_fs_res_t fs_read_cb(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
+    storage_file_t* f = (storage_file_t*)file_p;
+    if (!isOpen(f)) {
         *br = 0;
         return LV_FS_RES_FS_ERR;
     }
-    *br = file->read((uint8_t*)buf, btr);
+    
+    if (f->cached.entry >= 0) {
+        uint32_t n = f->pos < f->cached.size ? f->cached.size - f->pos : 0;
+        if (n > btr) n = btr;
+        memcpy(buf, f->cached.data + f->pos, n);
+        f->pos += n;
+        *br = n;
+        return LV_FS_RES_OK;
+    }
+    
+    uint32_t n = f->block.read(f->pos, (uint8_t*)buf, btr, readAheadSize, deviceRead, f, &fsStats.readAhead);
+    f->pos += n;
+    *br = n;
     return LV_FS_RES_OK;
 }
 
-static lv_fs_res_t sd_seek_cb(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) return LV_FS_RES_FS_ERR;
+static lv_fs_res_t fs_write_cb(lv_fs_drv_t* drv, void* file_p, const void* buf, uint32_t btw, uint32_t* bw) {
+    storage_file_t* f = (storage_file_t*)file_p;
+    if (!f || !f->file || !f->writable) {
+        *bw = 0;
+        return LV_FS_RES_DENIED;
+    }
+    
+    file_op_t op = {};
+    op.kind = FILE_OP_WRITE;
+    op.file = &f->file;
+    op.pos = f->filePos != f->pos ? f->pos : FILE_OP_NO_SEEK;
+    op.buf = (uint8_t*)buf;
+    op.len = btw;
+    int result = fileCall(f->drive, &op);
+    uint32_t n = result > 0 ? result : 0;
+    f->filePos = f->pos + n;
+    if (f->filePos > f->size) f->size = f->filePos;
+    
+    f->block.written(f->pos, n);
+    f->pos += n;
+    
+    *bw = n;
+    return n == btw ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+
+// Only moves LVGL's position; the file itself is repositioned on the next
+// device read
+static lv_fs_res_t fs_seek_cb(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
+    storage_file_t* f = (storage_file_t*)file_p;
+    if (!isOpen(f)) return LV_FS_RES_FS_ERR;
     
-    SeekMode mode = SeekSet;
-    if (whence == LV_FS_SEEK_CUR) mode = SeekCur;
-    else if (whence == LV_FS_SEEK_END) mode = SeekEnd;
+    if (whence == LV_FS_SEEK_CUR) pos += f->pos;
+    else if (whence == LV_FS_SEEK_END) pos += f->cached.entry >= 0 ? f->cached.size : f->size;
     
-    file->seek(pos, mode);
+    f->pos = pos;
+    if (f->cached.entry < 0) {
+        f->block.seek(pos, &fsStats.readAhead);
+    }
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell_cb(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
+    storage_file_t* f = (storage_file_t*)file_p;
+    if (!isOpen(f)) return LV_FS_RES_FS_ERR;
+    *pos_p = f->pos;
     return LV_FS_RES_OK;
 }
 
-static lv_fs_res_t sd_tell_cb(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
-    fs::File* file = (fs::File*)file_p;
-    if (!file || !*file) return LV_FS_RES_FS_ERR;
-    *pos_p = file->position();
+static void* fs_dir_open_cb(lv_fs_drv_t* drv, const char* path) {
+    fs::FS* fs = (fs::FS*)drv->user_data;
+    char fullPath[STORAGE_PATH_MAX];
+    if (!filePool || !formatPath(fullPath, path)) return NULL;
+    
+    storage_file_t* f = takeSlot('\0', "");
+    if (!f) {
+        fsStats.poolFull++;
+        return NULL;
+    }
+    
+    // Directories never read through a block
+    f->block.release();
+    file_op_t op = {};
+    op.kind = FILE_OP_OPEN;
+    op.fs = fs;
+    op.file = &f->file;
+    op.path = fullPath;
+    op.mode = "r";
+    f->drive = drv->letter;
+    if (fileCall(drv->letter, &op) != 1) {
+        releaseSlot(f);
+        return NULL;
+    }
+    
+    f->state = FILE_SLOT_OPEN;
+    f->writable = false;
+    f->isDir = true;
+    f->lastUsed = ++fileUseCounter;
+    return f;
+}
+
+// Directories come back with a leading '/', as LVGL's own drivers do. An
+// empty name ends the listing.
+static lv_fs_res_t fs_dir_read_cb(lv_fs_drv_t* drv, void* rddir_p, char* fn) {
+    storage_file_t* f = (storage_file_t*)rddir_p;
+    fn[0] = '\0';
+    if (!f || !f->isDir || !f->file) return LV_FS_RES_FS_ERR;
+    
+    file_op_t op = {};
+    op.kind = FILE_OP_NEXT;
+    op.file = &f->file;
+    op.name = fn;
+    return fileCall(f->drive, &op) >= 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+
+static lv_fs_res_t fs_dir_close_cb(lv_fs_drv_t* drv, void* rddir_p) {
+    storage_file_t* f = (storage_file_t*)rddir_p;
+    if (f) {
+        releaseSlot(f);
+    }
     return LV_FS_RES_OK;
 }
 
+static void registerDrive(lv_fs_drv_t* drv, char letter, fs::FS* fs) {
+    lv_fs_drv_init(drv);
+    drv->letter = letter;
+    drv->user_data = fs;
+    drv->open_cb = fs_open_cb;
+    drv->close_cb = fs_close_cb;
+    drv->read_cb = fs_read_cb;
+    drv->seek_cb = fs_seek_cb;
+    drv->tell_cb = fs_tell_cb;
+    drv->write_cb = fs_write_cb;
+    drv->dir_open_cb = fs_dir_open_cb;
+    drv->dir_read_cb = fs_dir_read_cb;
+    drv->dir_close_cb = fs_dir_close_cb;
+    lv_fs_drv_register(drv);
+}
+
 void storage_fs_init(void) {
-    lv_fs_drv_init(&spiffs_drv);
-    spiffs_drv.letter = STORAGE_DRIVE_SPIFFS;
-    spiffs_drv.open_cb = spiffs_open_cb;
-    spiffs_drv.close_cb = spiffs_close_cb;
-    spiffs_drv.read_cb = spiffs_read_cb;
-    spiffs_drv.seek_cb = spiffs_seek_cb;
-    spiffs_drv.tell_cb = spiffs_tell_cb;
-    lv_fs_drv_register(&spiffs_drv);
-    
-    lv_fs_drv_init(&sd_drv);
-    sd_drv.letter = STORAGE_DRIVE_SD;
-    sd_drv.open_cb = sd_open_cb;
-    sd_drv.close_cb = sd_close_cb;
-    sd_drv.read_cb = sd_read_cb;
-    sd_drv.seek_cb = sd_seek_cb;
-    sd_drv.tell_cb = sd_tell_cb;
-    lv_fs_drv_register(&sd_drv);
-}
-
-StorageManager::StorageManager() {
+    // Reads of a block or more bypass it, so 0 turns read-ahead off
+    uint32_t kb = Config.getStorageConfig().readAheadKB;
+    if (kb > STORAGE_READAHEAD_MAX_KB) kb = STORAGE_READAHEAD_MAX_KB;
+    readAheadSize = kb ? kb * 1024 : 1;
+    
+    if (!filePool) {
+        filePool = new storage_file_t[STORAGE_FILE_POOL]();
+        for (int i = 0; i < STORAGE_FILE_POOL; i++) {
+            filePool[i].cached.entry = -1;
+        }
+    }
+    
+    registerDrive(&spiffs_drv, STORAGE_DRIVE_SPIFFS, &SPIFFS);
+    registerDrive(&sd_drv, STORAGE_DRIVE_SD, &SD);
+}
+
+StorageManager::StorageManager() : cache(CACHE_DEFAULT_KB * 1024) {
     spiffsReady = false;
     sdReady = false;
-    cacheUsedMemory = 0;
-    accessCounter = 0;
-    initCache();
+    cacheLock = NULL;
+    memset(preloadJobs, 0, sizeof(preloadJobs));
+    preloadNextId = 1;
+    preloadTask = NULL;
 }
 
-StorageManager::~StorageManager() {
-    clearCache();
+void StorageManager::lockCache() {
+    if (cacheLock) xSemaphoreTake(cacheLock, portMAX_DELAY);
 }
 
-void StorageManager::initCache() {
-    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        cache[i].path[0] = '\0';
-        cache[i].data = NULL;
-        cache[i].size = 0;
-        cache[i].lastAccess = 0;
-        cache[i].valid = false;
-    }
-    cacheUsedMemory = 0;
+void StorageManager::unlockCache() {
+    if (cacheLock) xSemaphoreGive(cacheLock);
 }
 
 bool StorageManager::begin() {
     Serial.println("\n[Storage] Initializing...");
     
+    if (!cacheLock) {
+        cacheLock = xSemaphoreCreateMutex();
+    }
+    uint16_t cacheKB = Config.getStorageConfig().cacheKB;
+    cache.setBudget((size_t)(cacheKB ? cacheKB : CACHE_DEFAULT_KB) * 1024);
+    
     initSPIFFS();
     initSD();
+    if (sdReady) {
+        SdIO.begin();
+    }
     
     storage_fs_init();
+    startPreloader();
     
     Serial.println("[Storage] LVGL FS drivers registered");
     Serial.printf("  Drive F: (SPIFFS) %s\n", spiffsReady ? "READY" : "NOT READY");
@@ -209,224 +563,263 @@ bool StorageManager::initSD() {
     return true;
 }
 
-int StorageManager::findCacheEntry(const char* path) {
-    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        if (cache[i].valid && strcmp(cache[i].path, path) == 0) {
-            return i;
-        }
+bool StorageManager::acquireResource(const char* path, CacheHandle* handle) {
+    char key[STORAGE_PATH_MAX];
+    if (!cacheKey(path, key)) {
+        handle->data = NULL;
+        handle->size = 0;
+        handle->entry = -1;
+        return false;
     }
-    return -1;
+    if (findResource(key, handle)) {
+        return true;
+    }
+    return loadResource(key, ResourceCache::hashPath(key), handle, NULL);
 }
 
-int StorageManager::findLRUEntry() {
-    int lruIndex = -1;
-    uint32_t oldestAccess = UINT32_MAX;
+bool StorageManager::findResource(const char* path, CacheHandle* handle) {
+    handle->data = NULL;
+    handle->size = 0;
+    handle->entry = -1;
     
-    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        if (cache[i].valid && cache[i].lastAccess < oldestAccess) {
-            oldestAccess = cache[i].lastAccess;
-            lruIndex = i;
-        }
+    char key[STORAGE_PATH_MAX];
+    if (!cacheKey(path, key)) {
+        return false;
     }
-    return lruIndex;
-}
-
-int StorageManager::findFreeEntry() {
-    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        if (!cache[i].valid) {
-            return i;
-        }
+    uint32_t hash = ResourceCache::hashPath(key);
+    
+    lockCache();
+    int index = cache.lookup(key, hash);
+    if (index >= 0) {
+        cache.pin(index, handle);
     }
-    return -1;
+    unlockCache();
+    return index >= 0;
 }
 
-void StorageManager::evictEntry(int index) {
-    if (index < 0 || index >= CACHE_MAX_ENTRIES) return;
-    if (!cache[index].valid) return;
-    
-    if (cache[index].data) {
-        cacheUsedMemory -= cache[index].size;
-        free(cache[index].data);
-        cache[index].data = NULL;
+void StorageManager::dropResource(const char* path) {
+    char key[STORAGE_PATH_MAX];
+    if (!cacheKey(path, key)) {
+        return;
     }
+    uint32_t hash = ResourceCache::hashPath(key);
     
-    cache[index].path[0] = '\0';
-    cache[index].size = 0;
-    cache[index].lastAccess = 0;
-    cache[index].valid = false;
+    lockCache();
+    cache.remove(cache.find(key, hash));
+    unlockCache();
 }
 
-uint8_t* StorageManager::loadFromCache(const char* path, size_t* size) {
-    int index = findCacheEntry(path);
-    
-    if (index >= 0) {
-        cache[index].lastAccess = ++accessCounter;
-        *size = cache[index].size;
-        return cache[index].data;
+// Reads path into the cache, pinning it into handle when one is given.
+// The file is read without the lock so hits from other tasks are not held
+// up behind the card. Preload jobs read it in chunks, yielding between
+// them, and give up once cancelled.
+bool StorageManager::loadResource(const char* path, uint32_t hash, CacheHandle* handle, PreloadJob* job) {
+    // Preload chunks are background requests, so the IO task serves
+    // everything else between them
+    io_prio_t prio = job ? IO_PRIO_BACKGROUND : IO_PRIO_INTERACTIVE;
+    fs::File file;
+    char drive;
+    size_t fileSize;
+    if (!openFile(path, &file, &drive, &fileSize, prio)) {
+        return false;
     }
     
-    fs::File file = openFile(path);
-    if (!file) {
-        *size = 0;
-        return NULL;
+    // Evict before allocating so the new buffer does not have to fit
+    // alongside the ones it replaces
+    lockCache();
+    bool room = fileSize > 0 && cache.makeRoom(fileSize);
+    unlockCache();
+    if (!room) {
+        closeFile(drive, &file, prio);
+        return false;
     }
     
-    size_t fileSize = file.size();
-    
-    if (cacheUsedMemory + fileSize > CACHE_MAX_MEMORY) {
-        while (cacheUsedMemory + fileSize > CACHE_MAX_MEMORY) {
-            int lruIndex = findLRUEntry();
-            if (lruIndex < 0) break;
-            evictEntry(lruIndex);
-        }
+    uint8_t* buffer = (uint8_t*)malloc(fileSize);
+    if (!buffer) {
+        closeFile(drive, &file, prio);
+        return false;
     }
     
-    int freeIndex = findFreeEntry();
-    if (freeIndex < 0) {
-        int lruIndex = findLRUEntry();
-        if (lruIndex >= 0) {
-            evictEntry(lruIndex);
-            freeIndex = findFreeEntry();
+    size_t bytesRead = 0;
+    if (!job) {
+        int n = readFile(drive, &file, FILE_OP_NO_SEEK, buffer, fileSize, prio);
+        bytesRead = n > 0 ? n : 0;
+    } else {
+        while (bytesRead < fileSize && !__atomic_load_n(&job->cancel, __ATOMIC_RELAXED)) {
+            size_t chunk = fileSize - bytesRead;
+            if (chunk > PRELOAD_CHUNK_SIZE) chunk = PRELOAD_CHUNK_SIZE;
+            int n = readFile(drive, &file, FILE_OP_NO_SEEK, buffer + bytesRead, chunk, prio);
+            if (n <= 0) break;
+            bytesRead += n;
+            vTaskDelay(1);
         }
     }
-    
-    if (freeIndex < 0) {
-        file.close();
-        *size = 0;
-        return NULL;
+    closeFile(drive, &file, prio);
+    if (bytesRead != fileSize) {
+        free(buffer);
+        return false;
     }
     
-    uint8_t* buffer = (uint8_t*)malloc(fileSize);
-    if (!buffer) {
-        file.close();
-        *size = 0;
-        return NULL;
+    lockCache();
+    int index = cache.find(path, hash);
+    if (index >= 0) {
+        // Loaded by another task meanwhile
+        free(buffer);
+    } else {
+        index = cache.insert(path, hash, buffer, fileSize);
+        if (index < 0) {
+            free(buffer);
+            unlockCache();
+            return false;
+        }
     }
+    if (handle) {
+        cache.pin(index, handle);
+    }
+    unlockCache();
+    return true;
+}
+
+void StorageManager::releaseResource(CacheHandle* handle) {
+    if (!handle || handle->entry < 0) return;
     
-    file.read(buffer, fileSize);
-    file.close();
-    
-    strncpy(cache[freeIndex].path, path, sizeof(cache[freeIndex].path) - 1);
-    cache[freeIndex].path[sizeof(cache[freeIndex].path) - 1] = '\0';
-    cache[freeIndex].data = buffer;
-    cache[freeIndex].size = fileSize;
-    cache[freeIndex].lastAccess = ++accessCounter;
-    cache[freeIndex].valid = true;
-    cacheUsedMemory += fileSize;
+    lockCache();
+    cache.unpin(handle->entry);
+    unlockCache();
     
-    *size = fileSize;
-    return buffer;
+    handle->data = NULL;
+    handle->size = 0;
+    handle->entry = -1;
 }
 
 bool StorageManager::addToCache(const char* path, const uint8_t* data, size_t size) {
-    if (findCacheEntry(path) >= 0) {
-        return true;
-    }
-    
-    if (cacheUsedMemory + size > CACHE_MAX_MEMORY) {
-        while (cacheUsedMemory + size > CACHE_MAX_MEMORY) {
-            int lruIndex = findLRUEntry();
-            if (lruIndex < 0) break;
-            evictEntry(lruIndex);
-        }
-    }
+    char key[STORAGE_PATH_MAX];
+    if (size == 0 || !cacheKey(path, key)) return false;
     
-    int freeIndex = findFreeEntry();
-    if (freeIndex < 0) {
-        int lruIndex = findLRUEntry();
-        if (lruIndex >= 0) {
-            evictEntry(lruIndex);
-            freeIndex = findFreeEntry();
-        }
-    }
+    path = key;
+    uint32_t hash = ResourceCache::hashPath(path);
     
-    if (freeIndex < 0) return false;
+    lockCache();
+    bool cached = cache.find(path, hash) >= 0;
+    bool room = cached || cache.makeRoom(size);
+    unlockCache();
+    if (cached) return true;
+    if (!room) return false;
     
     uint8_t* buffer = (uint8_t*)malloc(size);
     if (!buffer) return false;
     
     memcpy(buffer, data, size);
     
-    strncpy(cache[freeIndex].path, path, sizeof(cache[freeIndex].path) - 1);
-    cache[freeIndex].path[sizeof(cache[freeIndex].path) - 1] = '\0';
-    cache[freeIndex].data = buffer;
-    cache[freeIndex].size = size;
-    cache[freeIndex].lastAccess = ++accessCounter;
-    cache[freeIndex].valid = true;
-    cacheUsedMemory += size;
+    lockCache();
+    int index = cache.find(path, hash);
+    if (index >= 0) {
+        free(buffer);
+    } else {
+        index = cache.insert(path, hash, buffer, size);
+        if (index < 0) free(buffer);
+    }
+    unlockCache();
     
-    return true;
+    return index >= 0;
 }
 
 void StorageManager::clearCache() {
-    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        if (cache[i].data) {
-            free(cache[i].data);
-            cache[i].data = NULL;
-        }
-        cache[i].valid = false;
-    }
-    cacheUsedMemory = 0;
+    lockCache();
+    cache.clear();
+    unlockCache();
 }
 
 void StorageManager::printCacheStatus() {
     Serial.println("\n[Storage] Cache Status");
     Serial.println("---------------------");
     
+    lockCache();
     int validCount = 0;
+    int pinnedCount = 0;
     for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
-        if (cache[i].valid) {
+        const CacheEntry& e = cache.getEntry(i);
+        if (e.valid) {
             validCount++;
-            Serial.printf("  [%d] %s: %d bytes\n", i, cache[i].path, cache[i].size);
+            if (e.refs > 0) pinnedCount++;
+            Serial.printf("  [%d] %s: %d bytes, %d refs\n", i, e.path, e.size, e.refs);
         }
     }
     
-    Serial.printf("  Entries: %d/%d\n", validCount, CACHE_MAX_ENTRIES);
-    Serial.printf("  Memory: %d/%d bytes\n", cacheUsedMemory, CACHE_MAX_MEMORY);
+    Serial.printf("  Entries: %d/%d (%d pinned)\n", validCount, CACHE_MAX_ENTRIES, pinnedCount);
+    Serial.printf("  Memory: %d/%d bytes\n", cache.getUsedMemory(), cache.getBudget());
+    Serial.printf("  Hits: %u, Misses: %u, Evictions: %u, Rejected: %u\n",
+                  cache.getHits(), cache.getMisses(), cache.getEvictions(), cache.getRejects());
+    unlockCache();
     Serial.println("---------------------");
 }
 
-fs::File StorageManager::openFile(const char* path) {
-    if (path[0] == STORAGE_DRIVE_SPIFFS && path[1] == ':') {
-        if (!spiffsReady) return fs::File();
-        return SPIFFS.open(path + 2, "r");
-    }
-    else if (path[0] == STORAGE_DRIVE_SD && path[1] == ':') {
-        if (!sdReady) return fs::File();
-        return SD.open(path + 2, "r");
+// "F:" and "S:" pick the drive; a bare path tries SPIFFS, then the card.
+// *drive tells the caller where the file's later operations must go.
+bool StorageManager::resolvePath(const char* path, char* drive, const char** fsPath) {
+    if ((path[0] == STORAGE_DRIVE_SPIFFS || path[0] == STORAGE_DRIVE_SD) && path[1] == ':') {
+        *drive = path[0];
+        *fsPath = path + 2;
+        return *drive == STORAGE_DRIVE_SD ? sdReady : spiffsReady;
     }
     
-    if (spiffsReady) {
-        fs::File f = SPIFFS.open(path, "r");
-        if (f) return f;
+    *fsPath = path;
+    if (spiffsReady && SPIFFS.exists(path)) {
+        *drive = STORAGE_DRIVE_SPIFFS;
+        return true;
     }
-    
-    if (sdReady) {
-        return SD.open(path, "r");
+    *drive = STORAGE_DRIVE_SD;
+    return sdReady;
+}
+
+// Cache entries are keyed "F:/path" or "S:/path", the form the drivers
+// see. key holds STORAGE_PATH_MAX bytes, the size of a CacheEntry path.
+bool StorageManager::cacheKey(const char* path, char* key) {
+    char drive;
+    const char* fsPath;
+    if (!resolvePath(path, &drive, &fsPath)) {
+        return false;
     }
+    int len = snprintf(key, STORAGE_PATH_MAX, "%c:%s%s", drive, fsPath[0] == '/' ? "" : "/", fsPath);
+    return len > 0 && len < STORAGE_PATH_MAX;
+}
+
+bool StorageManager::openFile(const char* path, fs::File* file, char* drive, size_t* size, io_prio_t prio) {
+    file_op_t op = {};
+    op.kind = FILE_OP_OPEN;
+    op.file = file;
+    op.mode = "r";
+    if (!resolvePath(path, drive, &op.path)) {
+        return false;
+    }
+    op.fs = *drive == STORAGE_DRIVE_SD ? (fs::FS*)&SD : (fs::FS*)&SPIFFS;
     
-    return fs::File();
+    int result = fileCall(*drive, &op, prio);
+    if (result != 0) {
+        closeFile(*drive, file, prio);
+        return false;
+    }
+    *size = op.size;
+    return true;
 }
 
 bool StorageManager::fileExists(const char* path) {
-    if (path[0] == STORAGE_DRIVE_SPIFFS && path[1] == ':') {
-        return spiffsReady && SPIFFS.exists(path + 2);
-    }
-    else if (path[0] == STORAGE_DRIVE_SD && path[1] == ':') {
-        return sdReady && SD.exists(path + 2);
+    char drive;
+    file_op_t op = {};
+    op.kind = FILE_OP_EXISTS;
+    if (!resolvePath(path, &drive, &op.path)) {
+        return false;
     }
-    
-    if (spiffsReady && SPIFFS.exists(path)) return true;
-    if (sdReady && SD.exists(path)) return true;
-    
-    return false;
+    op.fs = drive == STORAGE_DRIVE_SD ? (fs::FS*)&SD : (fs::FS*)&SPIFFS;
+    return fileCall(drive, &op) > 0;
 }
 
 size_t StorageManager::getFileSize(const char* path) {
-    fs::File file = openFile(path);
-    if (!file) return 0;
-    size_t size = file.size();
-    file.close();
+    fs::File file;
+    char drive;
+    size_t size;
+    if (!openFile(path, &file, &drive, &size, IO_PRIO_INTERACTIVE)) return 0;
+    closeFile(drive, &file);
     return size;
 }
 
@@ -454,6 +847,16 @@ void StorageManager::listSPIFFS(const char* path) {
     }
 }
 
+// Runs on the IO task for each entry
+static bool print_entry_cb(const char* name, bool isDir, size_t size, void* ctx) {
+    if (isDir) {
+        Serial.printf("  DIR: %s\n", name);
+    } else {
+        Serial.printf("  %s: %d bytes\n", name, size);
+    }
+    return true;
+}
+
 void StorageManager::listSD(const char* path) {
     if (!sdReady) {
         Serial.println("SD card not ready");
@@ -461,35 +864,41 @@ void StorageManager::listSD(const char* path) {
     }
     
     Serial.printf("\n[SD] Listing %s:\n", path);
-    fs::File root = SD.open(path);
-    if (!root || !root.isDirectory()) {
+    if (SdIO.list(path, print_entry_cb, NULL, IO_PRIO_NORMAL) < 0) {
         Serial.println("  Failed to open directory");
-        return;
-    }
-    
-    fs::File file = root.openNextFile();
-    while (file) {
-        if (file.isDirectory()) {
-            Serial.printf("  DIR: %s\n", file.name());
-        } else {
-            Serial.printf("  %s: %d bytes\n", file.name(), file.size());
-        }
-        file = root.openNextFile();
     }
 }
 
 bool StorageManager::preloadResources(const char* manifestPath) {
-    fs::File file = openFile(manifestPath);
-    if (!file) {
-        Serial.printf("[Storage] Manifest not found: %s\n", manifestPath);
+    return runManifest(manifestPath, NULL);
+}
+
+bool StorageManager::runManifest(const char* manifestPath, PreloadJob* job) {
+    // Apps without a manifest are common; don't let SPIFFS log the miss
+    if (!fileExists(manifestPath)) {
+        if (!job) Serial.printf("[Storage] Manifest not found: %s\n", manifestPath);
         return false;
     }
     
-    String jsonContent = file.readString();
-    file.close();
+    io_prio_t prio = job ? IO_PRIO_BACKGROUND : IO_PRIO_INTERACTIVE;
+    fs::File file;
+    char drive;
+    size_t size;
+    if (!openFile(manifestPath, &file, &drive, &size, prio)) {
+        return false;
+    }
+    
+    char* jsonContent = (char*)malloc(size + 1);
+    int n = jsonContent ? readFile(drive, &file, FILE_OP_NO_SEEK, (uint8_t*)jsonContent, size, prio) : -1;
+    closeFile(drive, &file, prio);
+    if (n < 0) {
+        free(jsonContent);
+        return false;
+    }
     
     JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, jsonContent);
+    DeserializationError error = deserializeJson(doc, jsonContent, n);
+    free(jsonContent);
     
     if (error) {
         Serial.printf("[Storage] JSON parse error: %s\n", error.c_str());
@@ -497,30 +906,198 @@ bool StorageManager::preloadResources(const char* manifestPath) {
     }
     
     JsonObject resources = doc["resources"];
+    static const char* const kinds[] = {"images", "fonts"};
     
-    if (resources["images"].is<JsonArray>()) {
-        JsonArray images = resources["images"];
-        for (JsonVariant img : images) {
-            const char* imgPath = img.as<const char*>();
-            size_t size;
-            if (loadFromCache(imgPath, &size)) {
-                Serial.printf("  Preloaded: %s (%d bytes)\n", imgPath, size);
+    for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+        if (!resources[kinds[k]].is<JsonArray>()) continue;
+        
+        JsonArray paths = resources[kinds[k]];
+        for (JsonVariant item : paths) {
+            if (job && __atomic_load_n(&job->cancel, __ATOMIC_RELAXED)) {
+                return false;
+            }
+            
+            char path[STORAGE_PATH_MAX];
+            const char* itemPath = item.as<const char*>();
+            if (!itemPath || !cacheKey(itemPath, path)) continue;
+            
+            uint32_t hash = ResourceCache::hashPath(path);
+            lockCache();
+            int index = cache.find(path, hash);
+            if (index >= 0) {
+                cache.touch(index);
+            }
+            unlockCache();
+            
+            if (index < 0 && !loadResource(path, hash, NULL, job)) {
+                continue;
+            }
+            if (!job) {
+                Serial.printf("  Preloaded: %s\n", path);
             }
         }
     }
     
-    if (resources["fonts"].is<JsonArray>()) {
-        JsonArray fonts = resources["fonts"];
-        for (JsonVariant font : fonts) {
-            const char* fontPath = font.as<const char*>();
-            size_t size;
-            if (loadFromCache(fontPath, &size)) {
-                Serial.printf("  Preloaded: %s (%d bytes)\n", fontPath, size);
-            }
+    return true;
+}
+
+void StorageManager::startPreloader() {
+    if (preloadTask) return;
+    
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        preloadTaskEntry,
+        "Preload",
+        PRELOAD_TASK_STACK,
+        this,
+        PRELOAD_TASK_PRIORITY,
+        &preloadTask,
+        PRELOAD_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        preloadTask = NULL;
+        Serial.println("[Storage] Failed to create preload task");
+    }
+}
+
+void StorageManager::preloadTaskEntry(void* arg) {
+    StorageManager* self = (StorageManager*)arg;
+    
+    while (true) {
+        PreloadJob* job = self->nextPreloadJob();
+        if (!job) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
         }
+        
+        // Cancelled before it started: skip the manifest entirely
+        if (__atomic_load_n(&job->cancel, __ATOMIC_RELAXED)) {
+            self->finishPreloadJob(job, PRELOAD_CANCELLED);
+            continue;
+        }
+        
+        bool ok = self->runManifest(job->manifest, job);
+        preload_state_t state = PRELOAD_DONE;
+        if (__atomic_load_n(&job->cancel, __ATOMIC_RELAXED)) {
+            state = PRELOAD_CANCELLED;
+        } else if (!ok) {
+            state = PRELOAD_FAILED;
+        }
+        self->finishPreloadJob(job, state);
     }
+}
+
+// Cancelled jobs still waiting in the queue come first so their callbacks
+// fire promptly; after that the highest priority, oldest first
+PreloadJob* StorageManager::nextPreloadJob() {
+    PreloadJob* next = NULL;
     
-    return true;
+    lockCache();
+    for (int i = 0; i < PRELOAD_MAX_JOBS; i++) {
+        PreloadJob* job = &preloadJobs[i];
+        if (job->state != PRELOAD_QUEUED) continue;
+        
+        if (!next) {
+            next = job;
+        } else if (job->cancel != next->cancel) {
+            if (job->cancel) next = job;
+        } else if (job->priority != next->priority) {
+            if (job->priority > next->priority) next = job;
+        } else if (job->id < next->id) {
+            next = job;
+        }
+    }
+    if (next) {
+        next->state = PRELOAD_RUNNING;
+    }
+    unlockCache();
+    
+    return next;
+}
+
+void StorageManager::finishPreloadJob(PreloadJob* job, preload_state_t state) {
+    lockCache();
+    uint32_t id = job->id;
+    preload_cb_t cb = job->cb;
+    void* ctx = job->ctx;
+    job->state = state;
+    unlockCache();
+    
+    if (cb) {
+        cb(id, state, ctx);
+    }
+}
+
+// Queues manifestPath to be loaded into the cache by the preloader task.
+// Higher priorities run first. Returns the job id, or 0 if the queue is
+// full or storage was never started.
+uint32_t StorageManager::preloadAsync(const char* manifestPath, uint8_t priority,
+                                      preload_cb_t cb, void* ctx) {
+    if (!preloadTask) return 0;
+    
+    lockCache();
+    // Reuse the oldest finished slot so recent results stay queryable
+    PreloadJob* slot = NULL;
+    for (int i = 0; i < PRELOAD_MAX_JOBS; i++) {
+        PreloadJob* job = &preloadJobs[i];
+        if (job->state == PRELOAD_QUEUED || job->state == PRELOAD_RUNNING) continue;
+        if (!slot || job->id < slot->id) {
+            slot = job;
+        }
+    }
+    
+    uint32_t id = 0;
+    if (slot) {
+        id = preloadNextId++;
+        if (preloadNextId == 0) preloadNextId = 1;
+        
+        strncpy(slot->manifest, manifestPath, sizeof(slot->manifest) - 1);
+        slot->manifest[sizeof(slot->manifest) - 1] = '\0';
+        slot->id = id;
+        slot->priority = priority;
+        slot->cancel = false;
+        slot->cb = cb;
+        slot->ctx = ctx;
+        slot->state = PRELOAD_QUEUED;
+    }
+    unlockCache();
+    
+    if (id) {
+        xTaskNotifyGive(preloadTask);
+    }
+    return id;
+}
+
+void StorageManager::cancelPreload(uint32_t jobId) {
+    if (!jobId) return;
+    
+    bool found = false;
+    lockCache();
+    for (int i = 0; i < PRELOAD_MAX_JOBS; i++) {
+        PreloadJob* job = &preloadJobs[i];
+        if (job->id == jobId && (job->state == PRELOAD_QUEUED || job->state == PRELOAD_RUNNING)) {
+            __atomic_store_n(&job->cancel, true, __ATOMIC_RELAXED);
+            found = true;
+        }
+    }
+    unlockCache();
+    
+    if (found) {
+        xTaskNotifyGive(preloadTask);
+    }
+}
+
+preload_state_t StorageManager::getPreloadState(uint32_t jobId) {
+    preload_state_t state = PRELOAD_NONE;
+    
+    lockCache();
+    for (int i = 0; i < PRELOAD_MAX_JOBS; i++) {
+        if (jobId && preloadJobs[i].id == jobId) {
+            state = preloadJobs[i].state;
+        }
+    }
+    unlockCache();
+    
+    return state;
 }
 
 void StorageManager::printStatus() {
@@ -528,6 +1105,15 @@ void StorageManager::printStatus() {
     Serial.println("----------------------");
     Serial.printf("  SPIFFS:  %s\n", spiffsReady ? "READY" : "NOT READY");
     Serial.printf("  SD Card: %s\n", sdReady ? "READY" : "NOT READY");
-    Serial.printf("  Cache:   %d/%d bytes used\n", cacheUsedMemory, CACHE_MAX_MEMORY);
+    Serial.printf("  Cache:   %d/%d bytes used\n", cache.getUsedMemory(), cache.getBudget());
+    const readahead_stats_t& ra = fsStats.readAhead;
+    Serial.printf("  Read-ahead: %u B blocks, %u/%u reads from RAM (%u%%)\n",
+                  readAheadSize, ra.hits, ra.reads, ra.reads ? ra.hits * 100 / ra.reads : 0);
+    Serial.printf("              %u device reads, %u KB saved, %u invalidated\n",
+                  ra.deviceReads, ra.bytesSaved / 1024, ra.invalidations);
+    Serial.printf("  Handles: %u opens, %u reopened warm, %u from cache, %u refused (pool of %d)\n",
+                  fsStats.opens, fsStats.reopens, fsStats.cacheOpens, fsStats.poolFull, STORAGE_FILE_POOL);
     Serial.println("----------------------");
+    
+    SdIO.printStats();
 }
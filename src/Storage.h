@@ -6,20 +6,51 @@
 #include <FS.h>
 #include <SPIFFS.h>
 #include <SD.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "ResourceCache.h"
+#include "IOScheduler.h"
 
 #define STORAGE_DRIVE_SPIFFS    'F'
 #define STORAGE_DRIVE_SD        'S'
 
-#define CACHE_MAX_ENTRIES       16
-#define CACHE_MAX_MEMORY        (32 * 1024)
+#define STORAGE_READAHEAD_DEFAULT_KB    4   // until storage_fs_init() reads the config
+#define STORAGE_READAHEAD_MAX_KB        16
+#define STORAGE_FILE_POOL               8   // LVGL file and directory handles
+#define STORAGE_PARKED_BLOCKS           2   // closed handles that keep their block
+#define STORAGE_PATH_MAX                128
+
+#define CACHE_DEFAULT_KB        32      // storage.cacheKB when unset
+
+#define PRELOAD_MAX_JOBS        4
+#define PRELOAD_CHUNK_SIZE      4096    // bytes read between yields
+#define PRELOAD_TASK_STACK      4096
+#define PRELOAD_TASK_PRIORITY   1
+#define PRELOAD_TASK_CORE       0
+
+typedef enum {
+    PRELOAD_NONE = 0,           // unknown id, or its slot was reused
+    PRELOAD_QUEUED,
+    PRELOAD_RUNNING,
+    PRELOAD_DONE,
+    PRELOAD_FAILED,
+    PRELOAD_CANCELLED
+} preload_state_t;
+
+// Called once per job on the preloader task when it finishes, fails or is
+// cancelled. Use Perf.postUi() to touch LVGL from here.
+typedef void (*preload_cb_t)(uint32_t jobId, preload_state_t state, void* ctx);
 
 typedef struct {
-    char path[128];
-    uint8_t* data;
-    size_t size;
-    uint32_t lastAccess;
-    bool valid;
-} CacheEntry;
+    char manifest[64];
+    uint32_t id;
+    uint8_t priority;
+    preload_state_t state;
+    bool cancel;
+    preload_cb_t cb;
+    void* ctx;
+} PreloadJob;
 
 typedef struct {
     char imagePath[64];
@@ -39,21 +70,30 @@ private:
     bool spiffsReady;
     bool sdReady;
     
-    CacheEntry cache[CACHE_MAX_ENTRIES];
-    size_t cacheUsedMemory;
-    uint32_t accessCounter;
+    ResourceCache cache;
+    SemaphoreHandle_t cacheLock;
+    
+    PreloadJob preloadJobs[PRELOAD_MAX_JOBS];
+    uint32_t preloadNextId;
+    TaskHandle_t preloadTask;
     
     void initLVGLFileSystem();
-    void initCache();
+    void lockCache();
+    void unlockCache();
+    
+    bool resolvePath(const char* path, char* drive, const char** fsPath);
+    bool cacheKey(const char* path, char* key);
+    bool openFile(const char* path, fs::File* file, char* drive, size_t* size, io_prio_t prio);
+    bool loadResource(const char* path, uint32_t hash, CacheHandle* handle, PreloadJob* job);
+    bool runManifest(const char* manifestPath, PreloadJob* job);
     
-    int findCacheEntry(const char* path);
-    int findLRUEntry();
-    int findFreeEntry();
-    void evictEntry(int index);
+    static void preloadTaskEntry(void* arg);
+    void startPreloader();
+    PreloadJob* nextPreloadJob();
+    void finishPreloadJob(PreloadJob* job, preload_state_t state);
     
 public:
     StorageManager();
-    ~StorageManager();
     
     bool begin();
     
@@ -63,15 +103,24 @@ public:
     bool isSPIFFSReady() { return spiffsReady; }
     bool isSDReady() { return sdReady; }
     
-    uint8_t* loadFromCache(const char* path, size_t* size);
+    // Pins path into handle, reading it into the cache on a miss
+    bool acquireResource(const char* path, CacheHandle* handle);
+    // Pins path only if the cache already holds it; never reads the file
+    bool findResource(const char* path, CacheHandle* handle);
+    void releaseResource(CacheHandle* handle);
+    // Forgets the cached copy, e.g. before path is rewritten
+    void dropResource(const char* path);
     bool addToCache(const char* path, const uint8_t* data, size_t size);
     void clearCache();
     void printCacheStatus();
     
     bool preloadResources(const char* manifestPath);
+    uint32_t preloadAsync(const char* manifestPath, uint8_t priority = 0,
+                          preload_cb_t cb = nullptr, void* ctx = nullptr);
+    void cancelPreload(uint32_t jobId);
+    preload_state_t getPreloadState(uint32_t jobId);
     bool parseManifest(const char* jsonContent, ScreenManifest* manifest);
     
-    fs::File openFile(const char* path);
     bool fileExists(const char* path);
     size_t getFileSize(const char* path);
     
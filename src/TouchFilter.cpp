@@ -0,0 +1,54 @@
+#include "TouchFilter.h"
+#include <math.h>
+#include <string.h>
+
+bool touch_median(int16_t* v, int n, int maxSpread, int16_t* out) {
+    for (int i = 1; i < n; i++) {
+        int16_t t = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > t) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = t;
+    }
+    int mid = n / 2;
+    if (v[mid + 1] - v[mid - 1] > maxSpread) {
+        return false;
+    }
+    *out = v[mid];
+    return true;
+}
+
+static int16_t clampCoord(int32_t v, int limit) {
+    if (v < 0) return 0;
+    if (v > limit - 1) return limit - 1;
+    return v;
+}
+
+void touch_calibrate(const bsp_touch_cal_matrix_t& m, int16_t rx, int16_t ry,
+                     int width, int height, int16_t* x, int16_t* y) {
+    int32_t sx = lroundf(m.a * rx + m.b * ry + m.c);
+    int32_t sy = lroundf(m.d * rx + m.e * ry + m.f);
+    *x = clampCoord(sx, width);
+    *y = clampCoord(sy, height);
+}
+
+void touch_load_calibration(const float* cfg, int width, int height, bsp_touch_cal_matrix_t* m) {
+    static const float identity[6] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    if (memcmp(cfg, identity, sizeof(identity)) == 0) {
+        m->a = (width - 1) / 3500.0f;
+        m->b = 0.0f;
+        m->c = 1.0f - 200 * m->a;
+        m->d = 0.0f;
+        m->e = (height - 1) / 3560.0f;
+        m->f = 1.0f - 240 * m->e;
+    } else {
+        m->a = cfg[0];
+        m->b = cfg[1];
+        m->c = cfg[2];
+        m->d = cfg[3];
+        m->e = cfg[4];
+        m->f = cfg[5];
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+
+#include <stdint.h>
+
+// XPT2046 sample filtering and calibration for BSP's touch task. Plain C++
+// with no Arduino headers, so the native test env builds it.
+
+// x' = a*x + b*y + c, y' = d*x + e*y + f on raw 12-bit readings
+typedef struct {
+    float a;
+    float b;
+    float c;
+    float d;
+    float e;
+    float f;
+} bsp_touch_cal_matrix_t;
+
+// Sorts v[0..n), n >= 3, and stores the median in out. Returns false when
+// the middle three readings are more than maxSpread counts apart.
+bool touch_median(int16_t* v, int n, int maxSpread, int16_t* out);
+
+// Maps a raw reading through m, clamped to a width x height panel
+void touch_calibrate(const bsp_touch_cal_matrix_t& m, int16_t rx, int16_t ry,
+                     int width, int height, int16_t* x, int16_t* y);
+
+// Builds m from the six config values. The config default is the identity,
+// which is not a usable mapping from ADC counts, so that falls back to the
+// panel's nominal 200..3700 x 240..3800 range.
+void touch_load_calibration(const float* cfg, int width, int height, bsp_touch_cal_matrix_t* m);
+
+#endif
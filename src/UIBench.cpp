@@ -0,0 +1,156 @@
+#include "UIBench.h"
+#include "AppManager.h"
+#include "BSP.h"
+#include "GlobalUI.h"
+#include "Performance.h"
+#include <lvgl.h>
+
+typedef struct {
+    uint32_t frames;
+    uint32_t totalUs;
+    uint32_t worstUs;
+    uint32_t pixels;            // invalidated area, summed over frames
+} bench_pass_t;
+
+static const char* benchScreens[] = {"Home", "Chat", "Dictionary", "FileExplorer"};
+
+static uint32_t countObjects(lv_obj_t* obj) {
+    uint32_t n = 1;
+    uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        n += countObjects(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+static lv_obj_t* findScrollable(lv_obj_t* obj) {
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLLABLE) && lv_obj_get_scroll_bottom(obj) > 0) {
+        return obj;
+    }
+    uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        lv_obj_t* found = findScrollable(lv_obj_get_child(obj, i));
+        if (found) {
+            return found;
+        }
+    }
+    return nullptr;
+}
+
+// Areas are not joined until the refresh itself, so overlaps count twice
+static uint32_t invalidPixels(lv_disp_t* disp) {
+    uint32_t px = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        px += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return px;
+}
+
+static void benchFrame(lv_disp_t* disp, bench_pass_t& pass) {
+    pass.pixels += invalidPixels(disp);
+
+    uint32_t start = micros();
+    lv_refr_now(disp);
+    // The last stripe may still be on the bus
+    bsp_display_flush_poll(true);
+    uint32_t us = micros() - start;
+
+    pass.frames++;
+    pass.totalUs += us;
+    if (us > pass.worstUs) {
+        pass.worstUs = us;
+    }
+}
+
+static uint32_t passAvg(const bench_pass_t& pass) {
+    return pass.frames ? pass.totalUs / pass.frames : 0;
+}
+
+static void benchRedraws(lv_disp_t* disp, lv_obj_t* scrollable, bench_pass_t& redraw, bench_pass_t& scroll) {
+    for (int i = 0; i < UI_BENCH_REDRAWS; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        benchFrame(disp, redraw);
+    }
+
+    if (scrollable) {
+        for (int i = 0; i < UI_BENCH_SCROLLS; i++) {
+            lv_coord_t dy = i < UI_BENCH_SCROLLS / 2 ? -UI_BENCH_SCROLL_PX : UI_BENCH_SCROLL_PX;
+            lv_obj_scroll_by(scrollable, 0, dy, LV_ANIM_OFF);
+            benchFrame(disp, scroll);
+        }
+    }
+}
+
+static void benchScreen(lv_disp_t* disp, const char* name) {
+    LvglLock lock;
+
+    uint32_t start = micros();
+    bool ok = strcmp(name, "Home") == 0 ? AppMgr.switchToHome() : AppMgr.switchToApp(name);
+    uint32_t createUs = micros() - start;
+    if (!ok) {
+        Serial.printf("[Bench] %s,switch failed\n", name);
+        return;
+    }
+
+    bench_pass_t first = {};
+    benchFrame(disp, first);
+
+    uint32_t objects = countObjects(lv_scr_act()) + countObjects(lv_layer_top());
+
+    lv_obj_t* scrollable = findScrollable(lv_scr_act());
+    GlobalUI& ui = GlobalUI::getInstance();
+    bool wasOpen = ui.isSidebarOpen();
+    bench_pass_t settle = {};
+
+    ui.setSidebarOpen(false, false);
+    benchFrame(disp, settle);
+    bench_pass_t redraw = {};
+    bench_pass_t scroll = {};
+    benchRedraws(disp, scrollable, redraw, scroll);
+
+    // The sidebar overlaps what is redrawn beneath it on every frame
+    ui.setSidebarOpen(true, false);
+    benchFrame(disp, settle);
+    bench_pass_t redrawOpen = {};
+    bench_pass_t scrollOpen = {};
+    benchRedraws(disp, scrollable, redrawOpen, scrollOpen);
+
+    ui.setSidebarOpen(wasOpen, false);
+    benchFrame(disp, settle);
+
+    lv_mem_monitor_t mem;
+    lv_mem_monitor(&mem);
+
+    Serial.printf("[Bench] %s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+        name, objects, createUs, first.totalUs, first.pixels,
+        passAvg(redraw), redraw.worstUs, redraw.frames ? redraw.pixels / redraw.frames : 0,
+        passAvg(scroll), scroll.frames ? scroll.pixels / scroll.frames : 0,
+        passAvg(redrawOpen), passAvg(scrollOpen),
+        mem.total_size - mem.free_size);
+}
+
+void ui_bench_run(void) {
+    lv_disp_t* disp = lv_disp_get_default();
+    if (!disp) {
+        return;
+    }
+
+    Serial.println("\n[Bench] UI render benchmark");
+    Serial.println("[Bench] screen,objects,create_us,first_us,first_px,"
+                   "redraw_us,redraw_worst_us,redraw_px,scroll_us,scroll_px,"
+                   "redraw_sidebar_us,scroll_sidebar_us,lvgl_used");
+
+    for (size_t i = 0; i < sizeof(benchScreens) / sizeof(benchScreens[0]); i++) {
+        benchScreen(disp, benchScreens[i]);
+
+        // AppManager ignores switches for 100 ms after the last one
+        vTaskDelay(pdMS_TO_TICKS(150));
+        AppMgr.update();
+    }
+
+    {
+        LvglLock lock;
+        AppMgr.switchToHome();
+    }
+    Serial.println("[Bench] done\n");
+}
@@ -0,0 +1,21 @@
+#ifndef UI_BENCH_H
+#define UI_BENCH_H
+
+#include <Arduino.h>
+
+#define UI_BENCH_REDRAWS    10      // forced full-screen redraws per screen
+#define UI_BENCH_SCROLLS    10      // scroll steps per screen, half down, half back
+#define UI_BENCH_SCROLL_PX  20
+
+// Screen render benchmark, run once at boot when system.uiBench is set.
+//
+// Visits Home, Chat, Dictionary and FileExplorer through AppManager and,
+// for each one, times the first frame after the switch, forced full
+// redraws and scroll steps on the first scrollable container, with the
+// GlobalUI sidebar closed and then open. Frames are rendered with
+// lv_refr_now() on the calling task while it holds the LVGL lock, so times
+// include the panel transfer. Results go to Serial as one "[Bench]" CSV
+// line per screen.
+void ui_bench_run(void);
+
+#endif
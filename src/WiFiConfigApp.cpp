@@ -2,10 +2,11 @@
 #include "BSP.h"
 #include "PowerManager.h"
 #include "Storage.h"
+#include "Performance.h"
+#include "IOScheduler.h"
 #include <qrcode.h>
 #include <Preferences.h>
 #include <ArduinoJson.h>
-#include <SD.h>
 #include <time.h>
 
 WiFiConfigApp::WiFiConfigApp() : BaseApp("WiFiConfig") {
@@ -593,9 +594,19 @@ void WiFiConfigApp::hideQRUI() {
     }
 }
 
+// Status changes come from both LVGL callbacks and onUpdate() on the app
+// task, so the text is copied and applied on the LVGL task
 void WiFiConfigApp::updateStatus(const char* text) {
-    if (labelStatus) {
-        lv_label_set_text(labelStatus, text);
+    char buf[PERF_UI_DATA_MAX];
+    strncpy(buf, text, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    Perf.postUi(status_text_cb, this, buf, strlen(buf) + 1);
+}
+
+void WiFiConfigApp::status_text_cb(void* ctx, const void* data) {
+    WiFiConfigApp* app = (WiFiConfigApp*)ctx;
+    if (app->labelStatus) {
+        lv_label_set_text(app->labelStatus, (const char*)data);
     }
 }
 
@@ -637,15 +648,14 @@ bool WiFiConfigApp::saveWiFiConfigToSD(const char* ssid, const char* password) {
     doc["ssid"] = ssid;
     doc["password"] = password;
     
-    File file = SD.open(WIFI_CONFIG_FILE, FILE_WRITE);
-    if (!file) {
-        Serial.println("[WiFi] Failed to open config file for writing");
+    String json;
+    serializeJson(doc, json);
+    
+    if (!SdIO.write(WIFI_CONFIG_FILE, json.c_str(), json.length(), IO_PRIO_NORMAL)) {
+        Serial.println("[WiFi] Failed to queue config write");
         return false;
     }
     
-    serializeJson(doc, file);
-    file.close();
-    
     Serial.printf("[WiFi] Saved config to SD: %s\n", ssid);
     
     strncpy(_lastSSID, ssid, WIFI_MAX_SSID_LEN - 1);
@@ -666,22 +676,17 @@ bool WiFiConfigApp::loadWiFiConfigFromSD() {
         return false;
     }
     
-    if (!SD.exists(WIFI_CONFIG_FILE)) {
+    // Read on the IO task, after a save still queued for the same file
+    char json[(WIFI_MAX_SSID_LEN + WIFI_MAX_PASS_LEN) * 2 + 64];
+    int len = SdIO.read(WIFI_CONFIG_FILE, json, sizeof(json), IO_PRIO_INTERACTIVE);
+    if (len < 0) {
         Serial.println("[WiFi] No config file found on SD");
         _lastConfigValid = false;
         return false;
     }
     
-    File file = SD.open(WIFI_CONFIG_FILE, FILE_READ);
-    if (!file) {
-        Serial.println("[WiFi] Failed to open config file for reading");
-        _lastConfigValid = false;
-        return false;
-    }
-    
     JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, file);
-    file.close();
+    DeserializationError error = deserializeJson(doc, json, len);
     
     if (error) {
         Serial.printf("[WiFi] JSON parse error: %s\n", error.c_str());
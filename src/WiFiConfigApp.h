@@ -83,6 +83,7 @@ private:
     void stopAPMode();
     void drawQRCode(const char* data);
     void updateStatus(const char* text);
+    static void status_text_cb(void* ctx, const void* data);
     void updateStatus(const String& text);
     void clearNetworkList();
     void populateNetworkList();
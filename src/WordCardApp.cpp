@@ -2,6 +2,7 @@
 #include "AppManager.h"
 #include "Storage.h"
 #include "LvZhFont.h"
+#include "IOScheduler.h"
 #include <SD.h>
 #include <SPIFFS.h>
 
@@ -19,19 +20,24 @@ WordCardApp::WordCardApp() : BaseApp("WordCard") {
     memset(_words, 0, sizeof(_words));
 }
 
+int WordCardApp::load_words_io(void* ctx) {
+    File file = SD.open(WORD_FILE_PATH);
+    if (!file) return -1;
+    Serial.println("[WordCard] Loading from SD card");
+    return ((WordCardApp*)ctx)->parseWords(file) ? 1 : 0;
+}
+
 bool WordCardApp::loadWordsFromJson() {
-    File file;
-    bool fromSD = false;
-    
-    if (SD.begin()) {
-        file = SD.open(WORD_FILE_PATH);
-        if (file) {
-            fromSD = true;
-            Serial.println("[WordCard] Loading from SD card");
-        }
+    // BSP mounts the card once at boot; SD.begin() here would remount it
+    // with the default pins. The read goes through the IO task like every
+    // other SD access.
+    if (Storage.isSDReady()) {
+        int loaded = SdIO.run(load_words_io, this, IO_PRIO_INTERACTIVE, WORD_FILE_PATH);
+        if (loaded >= 0) return loaded > 0;
     }
     
-    if (!file && SPIFFS.begin()) {
+    File file;
+    if (SPIFFS.begin()) {
         file = SPIFFS.open(WORD_FILE_PATH);
         if (file) {
             Serial.println("[WordCard] Loading from SPIFFS");
@@ -56,6 +62,10 @@ bool WordCardApp::loadWordsFromJson() {
         return true;
     }
     
+    return parseWords(file);
+}
+
+bool WordCardApp::parseWords(File& file) {
     JsonDocument doc;
     DeserializationError error = deserializeJson(doc, file);
     file.close();
@@ -5,6 +5,7 @@
 #include "BSP.h"
 #include "PowerManager.h"
 #include <ArduinoJson.h>
+#include <FS.h>
 
 #define WORD_FILE_PATH "/word.json"
 #define MAX_WORDS 50
@@ -33,7 +34,9 @@ private:
     
     static void btn_next_cb(lv_event_t* e);
     
+    static int load_words_io(void* ctx);
     bool loadWordsFromJson();
+    bool parseWords(File& file);
     void updateDisplay();
     void showFront();
     void showBack();
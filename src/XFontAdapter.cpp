@@ -1,32 +1,11 @@
 #include "XFontAdapter.h"
-#include "font_index_map.h"
 #include "LvZhFont.h"
+#include "ConfigManager.h"
+#include "BSP.h"
+#include "IOScheduler.h"
+#include "xfont_hot.h"
 
 const char* XFontAdapter::s64 = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ@#*$";
-uint8_t XFontAdapter::pixBuf[128];
-
-uint32_t XFontAdapter::cacheUnicode[CACHE_SIZE];
-uint8_t XFontAdapter::cacheBitmap[CACHE_SIZE][72];
-int XFontAdapter::cacheIndex = 0;
-
-static const uint8_t s64Decode[256] PROGMEM = {
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255, 63, 66,255,255,255,255,255, 64,255,255,255,255,255,
-      0,  1,  2,  3,  4,  5,  6,  7,  8,  9,255,255,255,255,255,255,
-     62, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
-     51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,255, 65,255,255,255,
-    255, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
-     25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
-};
 
 unsigned long XFontAdapter::statLastPrint = 0;
 unsigned int XFontAdapter::statFindCharIndex = 0;
@@ -34,23 +13,40 @@ unsigned int XFontAdapter::statReadPixData = 0;
 unsigned int XFontAdapter::statGetGlyphBitmap = 0;
 unsigned int XFontAdapter::statDecodePixel = 0;
 unsigned int XFontAdapter::statCacheHit = 0;
+unsigned long XFontAdapter::statMissMicros = 0;
+unsigned int XFontAdapter::statPrefetchGlyphs = 0;
+unsigned int XFontAdapter::statPrefetchReads = 0;
+unsigned long XFontAdapter::statPrefetchMicros = 0;
 
 XFontAdapter XFontAdapter::instance;
 
 XFontAdapter::XFontAdapter() {
     initialized = false;
+    ioLock = nullptr;
+    portMUX_INITIALIZE(&cacheMux);
+    format = XFONT_FORMAT_LEGACY;
+    backend = XFONT_BACKEND_FILE;
+    mapBase = nullptr;
+    mapSize = 0;
+    mapHandle = 0;
     fontSize = 0;
+    bpp = 1;
+    glyphBytes = 0;
+    halfWidth = 0;
     binType = 0;
     fontPage = 0;
     totalChars = 0;
     unicodeBeginIdx = 0;
-    fontPath = "/x.font";
+    codepointOffset = 0;
+    xfbBitmapOffset = 0;
+    xfbGlyphStride = 0;
+    fontPath = XFONT_LEGACY_PATH;
     fileOpen = false;
     lastFileAccess = 0;
-    cacheIndex = 0;
-    for (int i = 0; i < CACHE_SIZE; i++) {
-        cacheUnicode[i] = 0xFFFFFFFF;
-    }
+    hotActive = false;
+    profile = nullptr;
+    profileDirty = false;
+    profileLastSave = 0;
 }
 
 XFontAdapter::~XFontAdapter() {
@@ -62,27 +58,139 @@ void XFontAdapter::end() {
         fontFile.close();
         fileOpen = false;
     }
+    if (mapBase) {
+        spi_flash_munmap(mapHandle);
+        mapBase = nullptr;
+        mapSize = 0;
+    }
+    backend = XFONT_BACKEND_FILE;
+    if (profile) {
+        saveProfile();
+        free(profile);
+        profile = nullptr;
+    }
+    index.clear();
+    cache.release();
+    hotActive = false;
     initialized = false;
 }
 
 bool XFontAdapter::begin(const char* path) {
     if (initialized) return true;
     
-    fontPath = path;
+    if (!ioLock) {
+        ioLock = xSemaphoreCreateMutex();
+    }
     
     if (!SPIFFS.begin()) {
         return false;
     }
     
-    if (!SPIFFS.exists(fontPath)) {
+    bool ok;
+    if (path) {
+        ok = openFont(path);
+    } else {
+        ok = openPartition() ||
+             (SPIFFS.exists(XFONT_BINARY_PATH) && openFont(XFONT_BINARY_PATH)) ||
+             openFont(XFONT_LEGACY_PATH);
+    }
+    
+    // Mapped glyphs are served straight from flash, no RAM cache needed.
+    if (ok && backend == XFONT_BACKEND_FILE && !allocCache(Config.getSystemConfig().glyphCacheSize)) {
+        Serial.println("[XFont] Glyph cache allocation failed, running uncached");
+    }
+    
+    if (ok) {
+        hotActive = XFONT_HOT_COUNT > 0 && XFONT_HOT_SIZE == fontSize && XFONT_HOT_BPP == bpp;
+        Serial.printf("[XFont] Hot subset: %d glyphs%s\n", XFONT_HOT_COUNT,
+                      hotActive ? "" : " (size/bpp mismatch, unused)");
+    }
+    
+    if (ok && Config.getSystemConfig().glyphProfile && !beginProfile()) {
+        Serial.println("[XFont] Glyph profile allocation failed");
+    }
+    
+    return ok;
+}
+
+bool XFontAdapter::openFont(const char* path) {
+    if (!SPIFFS.exists(path)) {
         return false;
     }
     
-    File f = SPIFFS.open(fontPath, "r");
+    File f = SPIFFS.open(path, "r");
     if (!f) {
         return false;
     }
     
+    char magic[4];
+    bool isBinary = f.read((uint8_t*)magic, 4) == 4 && memcmp(magic, XFB_MAGIC, 4) == 0;
+    f.seek(0);
+    
+    bool ok = isBinary ? loadBinaryHeader(f) : loadLegacyHeader(f);
+    if (ok) {
+        ok = buildIndex(&f);
+    }
+    f.close();
+    
+    if (!ok) {
+        Serial.printf("[XFont] Invalid font file: %s\n", path);
+        return false;
+    }
+    
+    fontPath = path;
+    initialized = true;
+    
+    Serial.printf("[XFont] %s: %s, size=%d, chars=%d, index=%u B\n", path,
+                  format == XFONT_FORMAT_BINARY ? "XFB" : "s64", fontSize, totalChars,
+                  (unsigned)index.getMemoryUsage());
+    
+    return true;
+}
+
+bool XFontAdapter::openPartition() {
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)XFONT_PARTITION_SUBTYPE,
+        XFONT_PARTITION_LABEL);
+    if (!part) {
+        return false;
+    }
+    
+    const void* ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+        Serial.println("[XFont] Font partition mmap failed");
+        return false;
+    }
+    
+    const xfb_header_t* hdr = (const xfb_header_t*)ptr;
+    if (!parseBinaryHeader(*hdr, part->size)) {
+        // Never flashed, or an image the partition cannot hold
+        spi_flash_munmap(handle);
+        return false;
+    }
+    
+    mapBase = (const uint8_t*)ptr;
+    mapSize = part->size;
+    mapHandle = handle;
+    backend = XFONT_BACKEND_PARTITION;
+    
+    if (!buildIndex(nullptr)) {
+        end();
+        return false;
+    }
+    
+    fontPath = "partition:" XFONT_PARTITION_LABEL;
+    initialized = true;
+    
+    Serial.printf("[XFont] partition '%s' @0x%06x: XFB, size=%d, chars=%d, index=%u B\n",
+                  part->label, (unsigned)part->address, fontSize, totalChars,
+                  (unsigned)index.getMemoryUsage());
+    
+    return true;
+}
+
+bool XFontAdapter::loadLegacyHeader(File& f) {
     uint8_t bufTotalStr[6];
     uint8_t bufFontSize[2];
     uint8_t bufBinType[2];
@@ -113,11 +221,121 @@ bool XFontAdapter::begin(const char* path) {
     int hexAmount = (total + hexCount - 1) / hexCount;
     fontPage = hexAmount * 2;
     
+    if ((total + 7) / 8 > XFONT_GLYPH_BUF_SIZE || fontPage > XFONT_GLYPH_BUF_SIZE) {
+        return false;
+    }
+    
+    codepointOffset = 10;
     unicodeBeginIdx = 10 + totalChars * 5;
+    halfWidth = fontSize / 2;
+    bpp = 1;
+    glyphBytes = (total + 7) / 8;
+    format = XFONT_FORMAT_LEGACY;
     
-    f.close();
+    return true;
+}
+
+bool XFontAdapter::loadBinaryHeader(File& f) {
+    xfb_header_t hdr;
+    if (f.read((uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) {
+        return false;
+    }
     
-    initialized = true;
+    return parseBinaryHeader(hdr, f.size());
+}
+
+bool XFontAdapter::parseBinaryHeader(const xfb_header_t& hdr, uint32_t imageSize) {
+    if (!xfb_header_valid(&hdr, imageSize, XFONT_GLYPH_BUF_SIZE)) {
+        // An erased partition is expected; say why a real image is refused
+        if (memcmp(hdr.magic, XFB_MAGIC, 4) != 0) {
+            return false;
+        }
+        if (hdr.bpp > XFB_MAX_BPP) {
+            Serial.printf("[XFont] XFB is %dbpp, at most %dbpp is supported\n", hdr.bpp, XFB_MAX_BPP);
+        } else if (xfb_image_size(&hdr) > imageSize) {
+            Serial.printf("[XFont] XFB %dbpp image needs %u B, only %u B to map\n", hdr.bpp,
+                          (unsigned)xfb_image_size(&hdr), (unsigned)imageSize);
+        } else {
+            Serial.println("[XFont] XFB header invalid");
+        }
+        return false;
+    }
+    
+    codepointOffset = hdr.codepointOffset;
+    xfbBitmapOffset = hdr.bitmapOffset;
+    xfbGlyphStride = hdr.glyphStride;
+    
+    fontSize = hdr.fontSize;
+    bpp = hdr.bpp;
+    glyphBytes = (hdr.fontSize * hdr.fontSize * hdr.bpp + 7) / 8;
+    halfWidth = hdr.halfWidth;
+    totalChars = hdr.glyphCount;
+    format = XFONT_FORMAT_BINARY;
+    
+    return true;
+}
+
+int XFontAdapter::readCodepoints(File* f, int first, uint16_t* out, int maxCount) {
+    int n = totalChars - first;
+    if (n > maxCount) n = maxCount;
+    if (n <= 0) return 0;
+    
+    if (format == XFONT_FORMAT_BINARY) {
+        size_t len = n * sizeof(uint16_t);
+        if (mapBase) {
+            memcpy(out, mapBase + codepointOffset + first * sizeof(uint16_t), len);
+            return n;
+        }
+        f->seek(codepointOffset + first * sizeof(uint16_t));
+        return f->read((uint8_t*)out, len) == len ? n : -1;
+    }
+    
+    // x.font index entries are "uXXXX"
+    char buf[5 * 64];
+    if (n > 64) n = 64;
+    f->seek(codepointOffset + first * 5);
+    if (f->read((uint8_t*)buf, n * 5) != (size_t)(n * 5)) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        char hex[5];
+        memcpy(hex, &buf[i * 5 + 1], 4);
+        hex[4] = '\0';
+        out[i] = (uint16_t)strtoul(hex, NULL, 16);
+    }
+    return n;
+}
+
+bool XFontAdapter::buildIndex(File* f) {
+    uint16_t cps[64];
+    bool sorted = format == XFONT_FORMAT_BINARY;
+    int passes = sorted ? 2 : 3;
+    
+    index.clear();
+    
+    for (int pass = 0; pass < passes; pass++) {
+        for (int first = 0; first < totalChars; ) {
+            int n = readCodepoints(f, first, cps, 64);
+            if (n <= 0) {
+                index.clear();
+                return false;
+            }
+            for (int i = 0; i < n; i++) {
+                if (pass == 0) index.reservePage(cps[i]);
+                else if (pass == 1) index.add(cps[i]);
+                else index.setOrder(cps[i], first + i);
+            }
+            first += n;
+        }
+        
+        bool ok = true;
+        if (pass == 0) ok = index.allocate();
+        else if (pass == 1) ok = index.finalize(totalChars, !sorted);
+        if (!ok) {
+            index.clear();
+            return false;
+        }
+    }
     
     return true;
 }
@@ -137,8 +355,21 @@ void XFontAdapter::checkFileClose() {
     }
 }
 
+void XFontAdapter::lockIO() {
+    if (ioLock) xSemaphoreTake(ioLock, portMAX_DELAY);
+}
+
+void XFontAdapter::unlockIO() {
+    if (ioLock) xSemaphoreGive(ioLock);
+}
+
 void XFontAdapter::update() {
+    lockIO();
     checkFileClose();
+    unlockIO();
+    if (profileDirty && millis() - profileLastSave >= XFONT_PROFILE_INTERVAL) {
+        saveProfile();
+    }
     printStats();
 }
 
@@ -153,6 +384,24 @@ void XFontAdapter::printStats() {
         Serial.printf("readPixData:    %u 次\n", statReadPixData);
         Serial.printf("getGlyphBitmap: %u 次\n", statGetGlyphBitmap);
         Serial.printf("cacheHit:       %u 次\n", statCacheHit);
+        const xfont_cache_stats_t& cacheStats = cache.getStats();
+        Serial.printf("cache:          %u/%u slots, %lu hit / %lu miss / %lu evict\n",
+                      cacheStats.used, cacheStats.capacity,
+                      (unsigned long)cacheStats.hits, (unsigned long)cacheStats.misses,
+                      (unsigned long)cacheStats.evictions);
+        unsigned int misses = statGetGlyphBitmap - statCacheHit;
+        Serial.printf("missTime:       %lu us (%lu us/次, %s%s)\n", statMissMicros,
+                      misses ? statMissMicros / misses : 0,
+                      format == XFONT_FORMAT_BINARY ? "XFB" : "s64",
+                      mapBase ? ", mmap" : "");
+        if (statPrefetchGlyphs) {
+            // Saving = what the same glyphs would have cost as single misses.
+            unsigned long perMiss = misses ? statMissMicros / misses : 0;
+            long saved = (long)(perMiss * statPrefetchGlyphs) - (long)statPrefetchMicros;
+            Serial.printf("prefetch:       %u 字 / %u 次读取, %lu us (省 ~%ld us)\n",
+                          statPrefetchGlyphs, statPrefetchReads, statPrefetchMicros,
+                          misses ? saved : 0L);
+        }
         Serial.println("--- 像素处理 ---");
         Serial.printf("decodePixel:    %u 次\n", statDecodePixel);
         Serial.println("==========================================\n");
@@ -162,6 +411,10 @@ void XFontAdapter::printStats() {
         statGetGlyphBitmap = 0;
         statDecodePixel = 0;
         statCacheHit = 0;
+        statMissMicros = 0;
+        statPrefetchGlyphs = 0;
+        statPrefetchReads = 0;
+        statPrefetchMicros = 0;
         LvZhFont::resetStats();
         statLastPrint = millis();
     }
@@ -170,86 +423,363 @@ void XFontAdapter::printStats() {
 int XFontAdapter::findCharIndex(uint32_t unicode) {
     statFindCharIndex++;
     if (unicode > 0xFFFF) return -1;
-    return pgm_read_word(&charIndexMap[unicode]);
+    
+    return index.find(unicode);
+}
+
+uint32_t XFontAdapter::glyphOffset(int charIndex) const {
+    if (format == XFONT_FORMAT_BINARY) {
+        return xfbBitmapOffset + (uint32_t)charIndex * xfbGlyphStride;
+    }
+    return unicodeBeginIdx + (uint32_t)charIndex * fontPage;
 }
 
-bool XFontAdapter::readPixData(int charIndex) {
+int XFontAdapter::glyphDataSize() const {
+    return format == XFONT_FORMAT_BINARY ? xfbGlyphStride : fontPage;
+}
+
+bool XFontAdapter::readGlyphData(int charIndex, uint8_t* out) {
     statReadPixData++;
     checkFileOpen();
     if (!fileOpen) return false;
     
-    int pixBeginIdx = unicodeBeginIdx + charIndex * fontPage;
-    fontFile.seek(pixBeginIdx);
-    fontFile.read(pixBuf, fontPage);
+    int len = glyphDataSize();
+    fontFile.seek(glyphOffset(charIndex));
+    return fontFile.read(out, len) == (size_t)len;
+}
+
+void XFontAdapter::unpackGlyph(const uint8_t* src, uint8_t* out, int width) {
+    memset(out, 0, glyphBytes);
+    
+    if (format == XFONT_FORMAT_BINARY) {
+        memcpy(out, src, (width * fontSize * bpp + 7) / 8);
+        return;
+    }
+    
+    xfont_s64_decode(src, fontPage, fontSize, width, out);
+    statDecodePixel += fontSize * fontSize;
+}
+
+bool XFontAdapter::allocCache(int capacity) {
+    if (!cache.allocate(capacity, glyphBytes)) {
+        return false;
+    }
+    
+    Serial.printf("[XFont] Glyph cache: %d slots x %d B (%dbpp), %u bytes\n", cache.getCapacity(),
+                  cache.getSlotSize(), bpp, (unsigned)cache.getMemoryUsage());
+    return true;
+}
+
+void XFontAdapter::resetCacheStats() {
+    portENTER_CRITICAL(&cacheMux);
+    cache.resetStats();
+    portEXIT_CRITICAL(&cacheMux);
+}
+
+// Cache critical sections only touch RAM (hash probe, LRU links and one
+// glyph memcpy), so a spinlock is enough and file I/O never runs inside it.
+bool XFontAdapter::cacheCopy(uint32_t unicode, uint8_t* out) {
+    if (cache.getCapacity() == 0) return false;
+    
+    portENTER_CRITICAL(&cacheMux);
+    bool hit = cache.copy(unicode, out);
+    portEXIT_CRITICAL(&cacheMux);
+    
+    if (hit) {
+        statCacheHit++;
+    }
+    return hit;
+}
+
+bool XFontAdapter::cacheContains(uint32_t unicode) {
+    portENTER_CRITICAL(&cacheMux);
+    bool found = cache.contains(unicode);
+    portEXIT_CRITICAL(&cacheMux);
+    return found;
+}
+
+void XFontAdapter::cacheInsert(uint32_t unicode, const uint8_t* bitmap) {
+    if (cache.getCapacity() == 0) return;
+    
+    // Another task may have loaded the same glyph while we were reading;
+    // insert() keeps the first copy.
+    portENTER_CRITICAL(&cacheMux);
+    cache.insert(unicode, bitmap);
+    portEXIT_CRITICAL(&cacheMux);
+}
+
+bool XFontAdapter::loadGlyph(int charIndex, uint8_t* out, int width) {
+    uint8_t raw[XFONT_GLYPH_BUF_SIZE];
+    
+    lockIO();
+    bool ok = readGlyphData(charIndex, raw);
+    unlockIO();
+    
+    if (ok) {
+        unpackGlyph(raw, out, width);
+    }
+    return ok;
+}
+
+const uint8_t* XFontAdapter::findHotGlyph(uint32_t unicode) const {
+    int lo = 0;
+    int hi = XFONT_HOT_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        uint16_t cp = pgm_read_word(&xfontHotCodepoints[mid]);
+        if (cp == unicode) return &xfontHotBitmaps[mid * XFONT_HOT_STRIDE];
+        if (cp < unicode) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return nullptr;
+}
+
+// Runs on the IO task. Keeps counting on top of what earlier boots recorded.
+int XFontAdapter::load_profile_io(void* ctx) {
+    XFontAdapter* self = (XFontAdapter*)ctx;
+    if (SD.exists(XFONT_PROFILE_PATH)) {
+        File f = SD.open(XFONT_PROFILE_PATH);
+        while (f && f.available()) {
+            String line = f.readStringUntil('\n');
+            int sp = line.indexOf(' ');
+            if (sp <= 0) continue;
+            uint32_t unicode = strtoul(line.substring(0, sp).c_str(), NULL, 16);
+            uint32_t count = strtoul(line.substring(sp + 1).c_str(), NULL, 10);
+            xfont_profile_entry_t* e = self->profileEntry(unicode);
+            if (e && count) {
+                e->unicode = unicode;
+                e->count = count > 0xFFFF ? 0xFFFF : count;
+            }
+        }
+        if (f) f.close();
+    }
+    return 0;
+}
+
+bool XFontAdapter::beginProfile() {
+    profile = (xfont_profile_entry_t*)calloc(XFONT_PROFILE_SLOTS, sizeof(xfont_profile_entry_t));
+    if (!profile) return false;
+    
+    if (bsp_is_sd_ready()) {
+        SdIO.run(load_profile_io, this, IO_PRIO_NORMAL, XFONT_PROFILE_PATH);
+    }
     
+    profileLastSave = millis();
+    Serial.printf("[XFont] Glyph profile enabled -> SD:%s\n", XFONT_PROFILE_PATH);
     return true;
 }
 
-int XFontAdapter::findInCache(uint32_t unicode) {
-    for (int i = 0; i < CACHE_SIZE; i++) {
-        if (cacheUnicode[i] == unicode) {
-            return i;
+// Entry holding unicode, or the empty slot it belongs in; nullptr if full.
+xfont_profile_entry_t* XFontAdapter::profileEntry(uint16_t unicode) {
+    int i = (uint32_t)(unicode * 2654435761UL) >> (32 - XFONT_PROFILE_BITS);
+    for (int n = 0; n < XFONT_PROFILE_SLOTS; n++) {
+        xfont_profile_entry_t* e = &profile[i];
+        if (e->count == 0 || e->unicode == unicode) {
+            return e;
         }
+        i = (i + 1) & (XFONT_PROFILE_SLOTS - 1);
+    }
+    return nullptr;
+}
+
+void XFontAdapter::profileRecord(uint32_t unicode) {
+    if (!profile || unicode > 0xFFFF) return;
+    
+    portENTER_CRITICAL(&cacheMux);
+    xfont_profile_entry_t* e = profileEntry(unicode);
+    if (e) {
+        e->unicode = unicode;
+        if (e->count < 0xFFFF) e->count++;
+        profileDirty = true;
     }
-    return -1;
+    portEXIT_CRITICAL(&cacheMux);
 }
 
-void XFontAdapter::addToCache(uint32_t unicode, const uint8_t* bitmap) {
-    cacheUnicode[cacheIndex] = unicode;
-    memcpy(cacheBitmap[cacheIndex], bitmap, 72);
-    cacheIndex = (cacheIndex + 1) % CACHE_SIZE;
+void XFontAdapter::saveProfile() {
+    if (!profile || !bsp_is_sd_ready()) return;
+    
+    size_t bytes = XFONT_PROFILE_SLOTS * sizeof(xfont_profile_entry_t);
+    xfont_profile_entry_t* snapshot = (xfont_profile_entry_t*)malloc(bytes);
+    if (!snapshot) return;
+    
+    portENTER_CRITICAL(&cacheMux);
+    memcpy(snapshot, profile, bytes);
+    profileDirty = false;
+    portEXIT_CRITICAL(&cacheMux);
+    
+    // "%04x %u\n" of two uint16_t is at most 11 characters
+    char* text = (char*)malloc(XFONT_PROFILE_SLOTS * 12);
+    if (text) {
+        size_t len = 0;
+        int written = 0;
+        for (int i = 0; i < XFONT_PROFILE_SLOTS; i++) {
+            if (snapshot[i].count) {
+                len += sprintf(text + len, "%04x %u\n", snapshot[i].unicode, snapshot[i].count);
+                written++;
+            }
+        }
+        // Queued as a background write so it never holds up a render
+        if (SdIO.write(XFONT_PROFILE_PATH, text, len, IO_PRIO_BACKGROUND)) {
+            Serial.printf("[XFont] Glyph profile saved: %d glyphs\n", written);
+        }
+        free(text);
+    }
+    
+    free(snapshot);
+    profileLastSave = millis();
 }
 
-const uint8_t* XFontAdapter::getGlyphBitmapPacked(uint32_t unicode, int* width, int* height) {
-    if (!initialized) return nullptr;
+const uint8_t* XFontAdapter::getMappedGlyph(uint32_t unicode) {
+    if (hotActive) {
+        const uint8_t* hot = findHotGlyph(unicode);
+        if (hot) {
+            statGetGlyphBitmap++;
+            profileRecord(unicode);
+            return hot;
+        }
+    }
+    
+    if (!mapBase) return nullptr;
     
     statGetGlyphBitmap++;
+    profileRecord(unicode);
+    int charIndex = findCharIndex(unicode);
+    if (charIndex >= 0) {
+        return mapBase + glyphOffset(charIndex);
+    }
+    static const uint8_t emptyGlyph[XFONT_GLYPH_BUF_SIZE] = {0};
+    return emptyGlyph;
+}
+
+bool XFontAdapter::copyGlyph(uint32_t unicode, uint8_t* out, int outSize, int* width, int* height) {
+    if (!initialized || outSize < glyphBytes) return false;
     
-    bool isAscii = (unicode <= 127);
-    *width = isAscii ? fontSize / 2 : fontSize;
+    *width = getGlyphWidth(unicode);
     *height = fontSize;
     
-    int cacheIdx = findInCache(unicode);
-    if (cacheIdx >= 0) {
-        statCacheHit++;
-        return cacheBitmap[cacheIdx];
+    const uint8_t* flashGlyph = getMappedGlyph(unicode);
+    if (flashGlyph) {
+        memcpy(out, flashGlyph, glyphBytes);
+        return true;
+    }
+    
+    return copyCachedGlyph(unicode, out, outSize, width, height);
+}
+
+bool XFontAdapter::copyCachedGlyph(uint32_t unicode, uint8_t* out, int outSize, int* width, int* height) {
+    if (!initialized || outSize < glyphBytes) return false;
+    
+    *width = getGlyphWidth(unicode);
+    *height = fontSize;
+    
+    statGetGlyphBitmap++;
+    profileRecord(unicode);
+    if (cacheCopy(unicode, out)) {
+        return true;
     }
     
-    static uint8_t packedBitmap[72];
-    memset(packedBitmap, 0, sizeof(packedBitmap));
+    unsigned long missStart = micros();
     
     int charIndex = findCharIndex(unicode);
+    if (charIndex < 0 || !loadGlyph(charIndex, out, *width)) {
+        memset(out, 0, glyphBytes);
+        return true;
+    }
     
-    if (charIndex < 0) {
-        return packedBitmap;
-    }
-    
-    if (!readPixData(charIndex)) {
-        return packedBitmap;
-    }
-    
-    int bitIdx = 0;
-    for (int i = 0; i < fontPage; i++) {
-        uint8_t c = pixBuf[i];
-        uint8_t d = pgm_read_byte(&s64Decode[c]);
-        if (d < 64) {
-            for (int k = 5; k >= 0; k--) {
-                statDecodePixel++;
-                int pixel = (d >> k) & 1;
-                if (pixel) {
-                    int x = bitIdx % fontSize;
-                    int y = bitIdx / fontSize;
-                    if (y < fontSize && x < *width) {
-                        int packedIdx = y * (*width) + x;
-                        packedBitmap[packedIdx / 8] |= (1 << (7 - (packedIdx % 8)));
-                    }
-                }
-                bitIdx++;
+    cacheInsert(unicode, out);
+    statMissMicros += micros() - missStart;
+    
+    return true;
+}
+
+static int compareByIndex(const void* a, const void* b) {
+    const xfont_prefetch_t* pa = (const xfont_prefetch_t*)a;
+    const xfont_prefetch_t* pb = (const xfont_prefetch_t*)b;
+    return (int)pa->charIndex - (int)pb->charIndex;
+}
+
+int XFontAdapter::prefetch(const char* utf8) {
+    if (!initialized || !utf8 || cache.getCapacity() == 0 || mapBase) return 0;
+    
+    unsigned long start = micros();
+    
+    // Collect uncached glyphs. Looking a glyph up also moves it to the LRU
+    // front, so what is already cached survives the batch below.
+    xfont_prefetch_t wanted[XFONT_PREFETCH_MAX];
+    int count = 0;
+    int maxCount = cache.getCapacity() < XFONT_PREFETCH_MAX ? cache.getCapacity() : XFONT_PREFETCH_MAX;
+    uint32_t i = 0;
+    while (utf8[i] && count < maxCount) {
+        uint32_t unicode = _lv_txt_encoded_next(utf8, &i);
+        if (unicode < 0x20 || (hotActive && findHotGlyph(unicode)) || cacheContains(unicode)) continue;
+        
+        int charIndex = findCharIndex(unicode);
+        if (charIndex < 0) continue;
+        
+        bool dup = false;
+        for (int k = 0; k < count; k++) {
+            if (wanted[k].charIndex == charIndex) {
+                dup = true;
+                break;
+            }
+        }
+        if (!dup) {
+            wanted[count].unicode = unicode;
+            wanted[count].charIndex = charIndex;
+            count++;
+        }
+    }
+    
+    if (count == 0) return 0;
+    
+    uint8_t* buf = (uint8_t*)malloc(XFONT_PREFETCH_BUF_SIZE);
+    if (!buf) return 0;
+    
+    qsort(wanted, count, sizeof(xfont_prefetch_t), compareByIndex);
+    
+    lockIO();
+    checkFileOpen();
+    
+    // Glyph slots are fixed-size, so file order is index order. Merge
+    // neighbours into one read while the gap stays small and the span
+    // fits the buffer.
+    int glyphLen = glyphDataSize();
+    int loaded = 0;
+    int first = 0;
+    while (fileOpen && first < count) {
+        uint32_t spanStart = glyphOffset(wanted[first].charIndex);
+        uint32_t spanEnd = spanStart + glyphLen;
+        int last = first;
+        while (last + 1 < count) {
+            uint32_t next = glyphOffset(wanted[last + 1].charIndex);
+            if (next - spanEnd > XFONT_PREFETCH_MAX_GAP ||
+                next + glyphLen - spanStart > XFONT_PREFETCH_BUF_SIZE) {
+                break;
+            }
+            spanEnd = next + glyphLen;
+            last++;
+        }
+        
+        statReadPixData++;
+        statPrefetchReads++;
+        fontFile.seek(spanStart);
+        if (fontFile.read(buf, spanEnd - spanStart) == spanEnd - spanStart) {
+            for (int k = first; k <= last; k++) {
+                uint8_t packed[XFONT_GLYPH_BUF_SIZE];
+                const uint8_t* src = buf + (glyphOffset(wanted[k].charIndex) - spanStart);
+                unpackGlyph(src, packed, getGlyphWidth(wanted[k].unicode));
+                cacheInsert(wanted[k].unicode, packed);
+                loaded++;
             }
         }
+        first = last + 1;
     }
     
-    addToCache(unicode, packedBitmap);
+    unlockIO();
+    free(buf);
+    
+    statPrefetchGlyphs += loaded;
+    statPrefetchMicros += micros() - start;
     
-    return packedBitmap;
+    return loaded;
 }
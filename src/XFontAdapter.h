@@ -5,18 +5,88 @@
 #include <SPIFFS.h>
 #include <lvgl.h>
 #include <pgmspace.h>
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "XFontIndex.h"
+#include "GlyphCache.h"
+#include "XFontDecode.h"
 
-#define CACHE_SIZE 16
+#define XFONT_BINARY_PATH       "/x.xfb"
+#define XFONT_LEGACY_PATH       "/x.font"
+// Largest raw glyph the adapter reads: a 24px 2bpp XFB slot, or an s64
+// page up to 41px
+#define XFONT_GLYPH_BUF_SIZE    288
 
+// Opt-in glyph usage profile (system.glyphProfile), see tools/xfont_hotset.py
+#define XFONT_PROFILE_PATH      "/glyph_usage.txt"
+#define XFONT_PROFILE_BITS      11
+#define XFONT_PROFILE_SLOTS     (1 << XFONT_PROFILE_BITS)
+#define XFONT_PROFILE_INTERVAL  60000
+
+// Raw data partition holding an XFB image (see partitions.csv)
+#define XFONT_PARTITION_LABEL   "font"
+#define XFONT_PARTITION_SUBTYPE 0x40
+
+#define XFONT_PREFETCH_MAX      128
+#define XFONT_PREFETCH_BUF_SIZE 2048
+#define XFONT_PREFETCH_MAX_GAP  256
+
+
+typedef enum {
+    XFONT_FORMAT_LEGACY = 0,
+    XFONT_FORMAT_BINARY = 1
+} xfont_format_t;
+
+typedef enum {
+    XFONT_BACKEND_FILE = 0,
+    XFONT_BACKEND_PARTITION = 1
+} xfont_backend_t;
+
+typedef struct {
+    uint32_t unicode;
+    int charIndex;
+} xfont_prefetch_t;
+
+typedef struct {
+    uint16_t unicode;
+    uint16_t count;
+} xfont_profile_entry_t;
+
+// The one glyph provider: LvZhFont, ZhFont and ZhDraw all read glyphs
+// through XFontAdapter::instance, so there is a single index, cache and
+// font handle.
+//
+// Glyph calls are reentrant: bitmaps are copied into caller buffers (or
+// point into read-only mapped flash), the cache is guarded by a spinlock
+// held only for RAM work, and fontFile by ioLock, which is never taken on
+// a cache hit.
 class XFontAdapter {
 private:
     bool initialized;
+    SemaphoreHandle_t ioLock;
+    portMUX_TYPE cacheMux;
+    xfont_format_t format;
+    xfont_backend_t backend;
+    
+    // Partition backend: the whole XFB image mapped into the data cache
+    const uint8_t* mapBase;
+    uint32_t mapSize;
+    spi_flash_mmap_handle_t mapHandle;
     int fontSize;
+    int bpp;
+    int glyphBytes;
+    int halfWidth;
     int binType;
     int fontPage;
     int totalChars;
     int unicodeBeginIdx;
     
+    XFontIndex index;
+    uint32_t codepointOffset;
+    uint32_t xfbBitmapOffset;
+    int xfbGlyphStride;
+    
     static const char* s64;
     
     String fontPath;
@@ -25,38 +95,90 @@ private:
     bool fileOpen;
     unsigned long lastFileAccess;
     
-    static uint8_t pixBuf[128];
+    GlyphCache cache;
+    
+    // Flash-resident hot subset (xfont_hot.h), used when it matches the font
+    bool hotActive;
     
-    static uint32_t cacheUnicode[CACHE_SIZE];
-    static uint8_t cacheBitmap[CACHE_SIZE][72];
-    static int cacheIndex;
+    // Usage profile: open-addressed codepoint -> fetch count
+    xfont_profile_entry_t* profile;
+    bool profileDirty;
+    unsigned long profileLastSave;
     
+    // Debug counters for printStats(). Updated without locking, so a
+    // concurrent task can occasionally lose an increment.
     static unsigned long statLastPrint;
     static unsigned int statFindCharIndex;
     static unsigned int statReadPixData;
     static unsigned int statGetGlyphBitmap;
     static unsigned int statDecodePixel;
     static unsigned int statCacheHit;
+    static unsigned long statMissMicros;
+    static unsigned int statPrefetchGlyphs;
+    static unsigned int statPrefetchReads;
+    static unsigned long statPrefetchMicros;
     
+    bool openFont(const char* path);
+    bool openPartition();
+    bool loadLegacyHeader(File& f);
+    bool loadBinaryHeader(File& f);
+    bool parseBinaryHeader(const xfb_header_t& hdr, uint32_t imageSize);
+    int readCodepoints(File* f, int first, uint16_t* out, int maxCount);
+    bool buildIndex(File* f);
     int findCharIndex(uint32_t unicode);
-    bool readPixData(int charIndex);
+    uint32_t glyphOffset(int charIndex) const;
+    int glyphDataSize() const;
+    bool readGlyphData(int charIndex, uint8_t* out);
+    void unpackGlyph(const uint8_t* src, uint8_t* out, int width);
     void checkFileOpen();
     void checkFileClose();
     void printStats();
-    int findInCache(uint32_t unicode);
-    void addToCache(uint32_t unicode, const uint8_t* bitmap);
+    void lockIO();
+    void unlockIO();
+    bool allocCache(int capacity);
+    bool cacheCopy(uint32_t unicode, uint8_t* out);
+    bool cacheContains(uint32_t unicode);
+    void cacheInsert(uint32_t unicode, const uint8_t* bitmap);
+    bool loadGlyph(int charIndex, uint8_t* out, int width);
+    const uint8_t* findHotGlyph(uint32_t unicode) const;
+    bool beginProfile();
+    static int load_profile_io(void* ctx);
+    xfont_profile_entry_t* profileEntry(uint16_t unicode);
+    void profileRecord(uint32_t unicode);
+    void saveProfile();
     
 public:
     XFontAdapter();
     ~XFontAdapter();
     
-    bool begin(const char* path = "/x.font");
+    bool begin(const char* path = nullptr);
     void end();
     void update();
     bool isInitialized() const { return initialized; }
     int getFontSize() const { return fontSize; }
+    int getBpp() const { return bpp; }
+    int getGlyphBytes() const { return glyphBytes; }
+    int getGlyphWidth(uint32_t unicode) const { return unicode <= 127 ? halfWidth : fontSize; }
+    xfont_format_t getFormat() const { return format; }
+    xfont_backend_t getBackend() const { return backend; }
+    size_t getIndexMemoryUsage() const { return index.getMemoryUsage(); }
+    const xfont_cache_stats_t& getCacheStats() const { return cache.getStats(); }
+    void resetCacheStats();
+    
+    // Copies the packed glyph (getGlyphBytes()) into out. Missing glyphs
+    // come back blank. Safe to call from any task.
+    bool copyGlyph(uint32_t unicode, uint8_t* out, int outSize, int* width, int* height);
+    // Zero-copy glyph in flash (hot subset or mapped partition), nullptr
+    // when the glyph has to come through the cache.
+    const uint8_t* getMappedGlyph(uint32_t unicode);
+    // copyGlyph() for callers that already got nullptr from
+    // getMappedGlyph(): goes straight to the cache and the font file.
+    bool copyCachedGlyph(uint32_t unicode, uint8_t* out, int outSize, int* width, int* height);
+    bool isProfiling() const { return profile != nullptr; }
     
-    const uint8_t* getGlyphBitmapPacked(uint32_t unicode, int* width, int* height);
+    // Load every uncached glyph of a UTF-8 string into the cache using as
+    // few file reads as possible. Returns the number of glyphs loaded.
+    int prefetch(const char* utf8);
     
     static XFontAdapter instance;
 };
@@ -0,0 +1,108 @@
+#include "XFontDecode.h"
+#include <string.h>
+
+static const uint8_t s64Decode[256] = {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255, 63, 66,255,255,255,255,255, 64,255,255,255,255,255,
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9,255,255,255,255,255,255,
+     62, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+     51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,255, 65,255,255,255,
+    255, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+     25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+};
+
+// Decodes one s64 glyph into packed rows. The bitstream is size x size
+// pixels, row-major, 6 bits per symbol; the output keeps only the
+// first `width` columns of each row, MSB first, without row padding.
+// Whole symbols are shifted into `acc` until a full row is available, so the
+// inner loop runs once per symbol and once per row instead of once per pixel.
+// `size` is a compile-time constant for the common fonts, which folds the
+// row mask and shifts; acc_t must hold size + 5 bits and width + 7 bits.
+template <typename acc_t>
+static inline __attribute__((always_inline))
+void s64DecodeRows(const uint8_t* src, int srcLen, int size, int width, uint8_t* out) {
+    const acc_t rowMask = ((acc_t)1 << size) - 1;
+    const int dropBits = size - width;
+    acc_t acc = 0;
+    int accBits = 0;
+    acc_t outAcc = 0;
+    int outBits = 0;
+    int i = 0;
+
+    for (int y = 0; y < size; y++) {
+        while (accBits < size && i < srcLen) {
+            uint8_t d = s64Decode[src[i++]];
+            if (d < 64) {
+                acc = (acc << 6) | d;
+                accBits += 6;
+            }
+        }
+        if (accBits < size) {
+            // Stream ran short (skipped symbols): zero-pad the partial row
+            if (accBits == 0) {
+                break;
+            }
+            acc <<= size - accBits;
+            accBits = size;
+        }
+        accBits -= size;
+        acc_t row = (acc >> accBits) & rowMask;
+        acc &= ((acc_t)1 << accBits) - 1;
+
+        outAcc = (outAcc << width) | (row >> dropBits);
+        outBits += width;
+        while (outBits >= 8) {
+            outBits -= 8;
+            *out++ = (uint8_t)(outAcc >> outBits);
+        }
+        outAcc &= ((acc_t)1 << outBits) - 1;
+    }
+    if (outBits > 0) {
+        *out = (uint8_t)(outAcc << (8 - outBits));
+    }
+}
+
+void xfont_s64_decode(const uint8_t* src, int srcLen, int size, int width, uint8_t* out) {
+    switch (size) {
+        case 16:
+            s64DecodeRows<uint32_t>(src, srcLen, 16, width, out);
+            break;
+        case 24:
+            s64DecodeRows<uint32_t>(src, srcLen, 24, width, out);
+            break;
+        default:
+            s64DecodeRows<uint64_t>(src, srcLen, size, width, out);
+            break;
+    }
+}
+
+bool xfb_header_valid(const xfb_header_t* hdr, uint32_t imageSize, int maxStride) {
+    if (memcmp(hdr->magic, XFB_MAGIC, 4) != 0 || hdr->version != XFB_VERSION) {
+        return false;
+    }
+    if (hdr->bpp == 0 || hdr->bpp > XFB_MAX_BPP) {
+        return false;
+    }
+    
+    int minStride = (hdr->fontSize * hdr->fontSize * hdr->bpp + 7) / 8;
+    if (hdr->fontSize == 0 || hdr->glyphStride < minStride || hdr->glyphStride > maxStride) {
+        return false;
+    }
+    
+    // 64-bit so a garbage header cannot wrap the bounds
+    uint64_t cpEnd = (uint64_t)hdr->codepointOffset + (uint64_t)hdr->glyphCount * sizeof(uint16_t);
+    return hdr->codepointOffset >= XFB_HEADER_SIZE && cpEnd <= imageSize && xfb_image_size(hdr) <= imageSize;
+}
+
+uint64_t xfb_image_size(const xfb_header_t* hdr) {
+    return (uint64_t)hdr->bitmapOffset + (uint64_t)hdr->glyphCount * hdr->glyphStride;
+}
@@ -0,0 +1,47 @@
+#ifndef XFONT_DECODE_H
+#define XFONT_DECODE_H
+
+#include <stdint.h>
+
+// Glyph formats read by XFontAdapter: the s64 decoder for the legacy
+// x.font and the XFB header check. Plain C++ with no Arduino headers, so
+// the native test env builds it.
+
+#define XFB_MAGIC               "XFB1"
+#define XFB_VERSION             1
+#define XFB_HEADER_SIZE         32
+// 4bpp images of the shipped font (~2.2 MB) fit neither the font partition
+// nor SPIFFS, so they are rejected rather than half loaded
+#define XFB_MAX_BPP             2
+
+// XFB header, written by tools/xfont_convert.py. Followed by a sorted
+// uint16 codepoint table and glyphCount fixed-size glyph slots.
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint8_t version;
+    uint8_t bpp;
+    uint8_t fontSize;
+    uint8_t halfWidth;
+    uint16_t glyphCount;
+    uint16_t glyphStride;
+    uint32_t codepointOffset;
+    uint32_t bitmapOffset;
+    uint32_t reserved;
+} xfb_header_t;
+
+// src holds size x size pixels, row-major, 6 bits per symbol; bytes that
+// are not 6-bit symbols are skipped. out receives the first `width` columns
+// of each row, MSB first, without row padding, and must be zeroed by the
+// caller. size may be at most 58.
+void xfont_s64_decode(const uint8_t* src, int srcLen, int size, int width, uint8_t* out);
+
+// True if hdr describes an XFB image of at most XFB_MAX_BPP whose codepoint
+// table and glyph slots lie within imageSize bytes and whose slots are at
+// most maxStride bytes. An erased (never flashed) partition fails the magic
+// check.
+bool xfb_header_valid(const xfb_header_t* hdr, uint32_t imageSize, int maxStride);
+
+// Bytes the image described by hdr needs: up to the end of its last slot
+uint64_t xfb_image_size(const xfb_header_t* hdr);
+
+#endif
@@ -0,0 +1,121 @@
+#include "XFontIndex.h"
+#include <stdlib.h>
+
+XFontIndex::XFontIndex() {
+    blocks = nullptr;
+    order = nullptr;
+    blockCount = 0;
+    count = 0;
+    for (int i = 0; i < XFONT_INDEX_PAGES; i++) {
+        pageBlock[i] = -1;
+    }
+}
+
+XFontIndex::~XFontIndex() {
+    clear();
+}
+
+void XFontIndex::clear() {
+    if (blocks) {
+        free(blocks);
+        blocks = nullptr;
+    }
+    if (order) {
+        free(order);
+        order = nullptr;
+    }
+    blockCount = 0;
+    count = 0;
+    for (int i = 0; i < XFONT_INDEX_PAGES; i++) {
+        pageBlock[i] = -1;
+    }
+}
+
+void XFontIndex::reservePage(uint16_t unicode) {
+    int page = unicode >> 8;
+    if (pageBlock[page] < 0) {
+        pageBlock[page] = blockCount++;
+    }
+}
+
+bool XFontIndex::allocate() {
+    if (blockCount == 0) {
+        return false;
+    }
+    blocks = (block_t*)calloc(blockCount, sizeof(block_t));
+    return blocks != nullptr;
+}
+
+void XFontIndex::add(uint16_t unicode) {
+    int blk = pageBlock[unicode >> 8];
+    if (blk < 0) return;
+    uint8_t low = unicode & 0xFF;
+    blocks[blk].bits[low >> 5] |= 1UL << (low & 31);
+}
+
+bool XFontIndex::finalize(int glyphCount, bool withOrder) {
+    int rank = 0;
+    for (int page = 0; page < XFONT_INDEX_PAGES; page++) {
+        int blk = pageBlock[page];
+        if (blk < 0) continue;
+        blocks[blk].base = rank;
+        for (int w = 0; w < XFONT_INDEX_PAGE_WORDS; w++) {
+            rank += __builtin_popcount(blocks[blk].bits[w]);
+        }
+    }
+
+    // Duplicate codepoints collapse into one bit, so the ranks would no
+    // longer line up with the glyph slots.
+    if (rank != glyphCount) {
+        return false;
+    }
+    count = glyphCount;
+
+    if (withOrder) {
+        order = (uint16_t*)malloc(count * sizeof(uint16_t));
+        if (!order) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void XFontIndex::setOrder(uint16_t unicode, uint16_t glyphIndex) {
+    int rank = rankOf(unicode);
+    if (rank >= 0 && order) {
+        order[rank] = glyphIndex;
+    }
+}
+
+int XFontIndex::rankOf(uint32_t unicode) const {
+    if (unicode > 0xFFFF || !blocks) return -1;
+
+    int blk = pageBlock[unicode >> 8];
+    if (blk < 0) return -1;
+
+    const block_t& b = blocks[blk];
+    uint8_t low = unicode & 0xFF;
+    int word = low >> 5;
+    uint32_t bit = 1UL << (low & 31);
+    if (!(b.bits[word] & bit)) return -1;
+
+    int rank = b.base + __builtin_popcount(b.bits[word] & (bit - 1));
+    for (int w = 0; w < word; w++) {
+        rank += __builtin_popcount(b.bits[w]);
+    }
+    return rank;
+}
+
+int XFontIndex::find(uint32_t unicode) const {
+    int rank = rankOf(unicode);
+    if (rank < 0) return -1;
+    return order ? order[rank] : rank;
+}
+
+size_t XFontIndex::getMemoryUsage() const {
+    size_t bytes = sizeof(pageBlock) + blockCount * sizeof(block_t);
+    if (order) {
+        bytes += count * sizeof(uint16_t);
+    }
+    return bytes;
+}
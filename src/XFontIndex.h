@@ -0,0 +1,56 @@
+#ifndef XFONT_INDEX_H
+#define XFONT_INDEX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define XFONT_INDEX_PAGES       256
+#define XFONT_INDEX_PAGE_WORDS  8
+
+// Sparse Unicode (BMP) -> glyph index, built from the font file at load time.
+//
+// The BMP is split into 256 pages of 256 codepoints. Only pages that contain
+// glyphs get a block: a 256-bit presence mask plus the rank of its first
+// glyph. A lookup is rank = base + popcount(mask bits below cp), i.e. O(1).
+// Rank is the position in sorted codepoint order; fonts whose glyphs are not
+// stored sorted (x.font) also keep a rank -> file index table.
+//
+// Building is three passes over the codepoint table:
+//   reservePage() for every cp, allocate(),
+//   add() for every cp, finalize(),
+//   setOrder() for every cp (only when finalize(..., true)).
+//
+// Plain C++ with no Arduino headers, so the native test env builds it.
+class XFontIndex {
+private:
+    typedef struct {
+        uint32_t bits[XFONT_INDEX_PAGE_WORDS];
+        uint16_t base;
+    } block_t;
+
+    int16_t pageBlock[XFONT_INDEX_PAGES];
+    block_t* blocks;
+    int blockCount;
+    uint16_t* order;
+    int count;
+
+    int rankOf(uint32_t unicode) const;
+
+public:
+    XFontIndex();
+    ~XFontIndex();
+
+    void clear();
+
+    void reservePage(uint16_t unicode);
+    bool allocate();
+    void add(uint16_t unicode);
+    bool finalize(int glyphCount, bool withOrder);
+    void setOrder(uint16_t unicode, uint16_t glyphIndex);
+
+    int find(uint32_t unicode) const;
+    int getCount() const { return count; }
+    size_t getMemoryUsage() const;
+};
+
+#endif
@@ -2,34 +2,26 @@
 #define ZH_DRAW_H
 
 #include <Arduino.h>
-#include <LittleFS.h>
 #include <lvgl.h>
+#include "XFontAdapter.h"
 
+// Draws text into RGB565 buffers using the shared XFontAdapter glyphs.
 class ZhDraw {
 private:
-    File fontFile;
     bool initialized;
-    int fontSize;
-    int fontPage;
-    int totalChars;
-    int unicodeBegin;
-    char* unicodeIndex;
-    
-    bool loadFont(const char* path);
-    int findCharIndex(uint16_t unicode);
     
 public:
     ZhDraw();
     ~ZhDraw();
     
-    bool begin(const char* path = "/x.font");
+    bool begin(const char* path = nullptr);
     void end();
     
-    bool isInitialized() const { return initialized; }
-    int getFontSize() const { return fontSize; }
+    bool isInitialized() const { return initialized && XFontAdapter::instance.isInitialized(); }
+    int getFontSize() const { return XFontAdapter::instance.getFontSize(); }
     
     int getTextWidth(const char* text);
-    int getTextHeight() const { return fontSize; }
+    int getTextHeight() const { return getFontSize(); }
     
     void drawText(uint16_t* buffer, int bufWidth, int bufHeight, 
                   int x, int y, const char* text, uint16_t color);
@@ -21,8 +21,10 @@
 
 #define LV_USE_SNAPSHOT 0
 #define LV_USE_SYSMON 1
-#define LV_USE_PERF_MONITOR 1
-#define LV_USE_MEM_MONITOR 1
+// Both overlays keep the refresh timer running (and redraw themselves), so
+// the LVGL task could never sleep. PerformanceManager reports the same data.
+#define LV_USE_PERF_MONITOR 0
+#define LV_USE_MEM_MONITOR 0
 #define LV_USE_REFR_MONITOR 0
 
 #define LV_FONT_MONTSERRAT_8 1
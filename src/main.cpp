@@ -19,6 +19,7 @@
 #include "GlobalUI.h"
 #include "LvZhFont.h"
 #include "XFontAdapter.h"
+#include "UIBench.h"
 
 static TaskHandle_t appTaskHandle = nullptr;
 
@@ -35,11 +36,24 @@ static void home_update_cb(lv_timer_t* timer) {
     if (labelHomePerf && lv_obj_is_valid(labelHomePerf)) {
         perf_stats_t stats = Perf.getStats();
         lv_label_set_text_fmt(labelHomePerf, 
-            "FPS: %u | Heap: %u KB | LVGL: %u KB",
+            "FPS: %u | Max %u ms\nR %u.%u | F %u.%u ms\n%u px/f | Touch %u ms",
             stats.fps,
-            stats.freeHeap / 1024,
-            stats.lvglMemUsed / 1024
+            stats.frameWorstUs / 1000,
+            stats.renderAvgUs / 1000, stats.renderAvgUs / 100 % 10,
+            stats.flushAvgUs / 1000, stats.flushAvgUs / 100 % 10,
+            stats.pixelsPerFrame,
+            stats.inputLatencyUs / 1000
         );
+        
+        if (labelHomeStatus && lv_obj_is_valid(labelHomeStatus)) {
+            lv_label_set_text_fmt(labelHomeStatus, 
+                "Heap: %u KB\nLVGL: %u KB\nCPU: %u%% | Wake: %u/s",
+                stats.freeHeap / 1024,
+                stats.lvglMemUsed / 1024,
+                stats.cpuUsage,
+                stats.wakeups
+            );
+        }
     }
 }
 
@@ -60,6 +74,16 @@ static void time_update_cb(lv_timer_t* timer) {
     }
 }
 
+// Warm the app's assets while the finger is still down
+static void app_btn_press_cb(lv_event_t* e) {
+    const char* appName = (const char*)lv_event_get_user_data(e);
+    if (lv_event_get_code(e) == LV_EVENT_PRESSED) {
+        AppMgr.preloadAppResources(appName);
+    } else {
+        AppMgr.cancelPreload();
+    }
+}
+
 static void app_btn_cb(lv_event_t* e) {
     const char* appName = (const char*)lv_event_get_user_data(e);
     Serial.printf("[Home] Launching app: %s\n", appName);
@@ -91,6 +115,8 @@ static void createHomeUI() {
         lv_obj_t* appBtn = lv_btn_create(container);
         lv_obj_set_size(appBtn, 90, 50);
         lv_obj_add_event_cb(appBtn, app_btn_cb, LV_EVENT_CLICKED, (void*)appName);
+        lv_obj_add_event_cb(appBtn, app_btn_press_cb, LV_EVENT_PRESSED, (void*)appName);
+        lv_obj_add_event_cb(appBtn, app_btn_press_cb, LV_EVENT_PRESS_LOST, (void*)appName);
         
         if (info.type == APP_TYPE_SYSTEM) {
             lv_obj_set_style_bg_color(appBtn, lv_color_make(0x00, 0x60, 0x80), 0);
@@ -132,6 +158,19 @@ static void createHomeUI() {
     lv_obj_set_style_text_font(labelDate, &lv_font_montserrat_14, 0);
     lv_obj_align(labelDate, LV_ALIGN_BOTTOM_MID, 0, -5);
     
+    labelHomeStatus = lv_label_create(timeContainer);
+    lv_label_set_text(labelHomeStatus, "");
+    lv_obj_set_style_text_color(labelHomeStatus, lv_color_make(0x90, 0x90, 0x90), 0);
+    lv_obj_set_style_text_font(labelHomeStatus, &lv_font_montserrat_10, 0);
+    lv_obj_align(labelHomeStatus, LV_ALIGN_TOP_LEFT, 0, 0);
+    
+    labelHomePerf = lv_label_create(timeContainer);
+    lv_label_set_text(labelHomePerf, "");
+    lv_obj_set_style_text_color(labelHomePerf, lv_color_make(0x90, 0x90, 0x90), 0);
+    lv_obj_set_style_text_font(labelHomePerf, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_text_align(labelHomePerf, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_align(labelHomePerf, LV_ALIGN_TOP_RIGHT, 0, 0);
+    
     timeUpdateTimer = lv_timer_create(time_update_cb, 1000, NULL);
     
     homeUpdateTimer = lv_timer_create(home_update_cb, 500, NULL);
@@ -152,9 +191,14 @@ static void backlight_mode_callback(backlight_mode_t newMode) {
 static void appTaskEntry(void* arg) {
     Serial.println("[App] Application task running on Core 0");
     
+    if (Config.getSystemConfig().uiBench) {
+        ui_bench_run();
+    }
+    
     while (true) {
         Power.update();
         AppMgr.update();
+        Perf.wakeIfDirty();
         XFontAdapter::instance.update();
         
         vTaskDelay(pdMS_TO_TICKS(50));
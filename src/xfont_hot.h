@@ -0,0 +1,907 @@
+// Auto-generated by tools/xfont_hotset.py - do not edit
+// Hot glyph subset served from flash before the font file is touched
+
+#pragma once
+
+#include <Arduino.h>
+
+#define XFONT_HOT_COUNT  146
+#define XFONT_HOT_SIZE   24
+#define XFONT_HOT_BPP    1
+#define XFONT_HOT_STRIDE 72
+
+// Sorted ascending for binary search
+const uint16_t xfontHotCodepoints[XFONT_HOT_COUNT] PROGMEM = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b,
+    0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x2190,
+    0x4e0d, 0x4e2d, 0x4e49, 0x4ea4, 0x4f4f, 0x4f53, 0x4fe1, 0x50cf, 0x5178, 0x53d6, 0x56de, 0x5730,
+    0x5904, 0x5b57, 0x5bbf, 0x5c42, 0x5e78, 0x6027, 0x61be, 0x641c, 0x6587, 0x6700, 0x6761, 0x679c,
+    0x6b21, 0x6bcf, 0x6c47, 0x6c9f, 0x6d41, 0x70ed, 0x7406, 0x7701, 0x79d2, 0x7d20, 0x7d22, 0x7ed3,
+    0x7edf, 0x80fd, 0x81b3, 0x82f1, 0x8ba1, 0x8bcd, 0x8bfb, 0x8fd1, 0x8fd4, 0x901a, 0x9057, 0x91ca,
+    0x95e8, 0xff1b,
+};
+
+const uint8_t xfontHotBitmaps[XFONT_HOT_COUNT * XFONT_HOT_STRIDE] PROGMEM = {
+    // U+0020
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0021
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0022
+    0x00, 0x00, 0x66, 0x0e, 0xe0, 0xcc, 0x19, 0x81, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0023
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x08, 0x40, 0x84, 0x08, 0x47, 0xfe, 0x7f, 0xe1, 0x04, 0x10,
+    0x81, 0x08, 0x10, 0x81, 0x08, 0x7f, 0xe7, 0xfe, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0024
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x0f, 0x81, 0xac, 0x32, 0xc3, 0x3c, 0x32, 0x01, 0xa0, 0x1e,
+    0x00, 0x70, 0x03, 0x80, 0x38, 0x02, 0xc3, 0x2c, 0x3a, 0xc3, 0x2c, 0x12, 0x80, 0xf0, 0x02, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0025
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x50, 0x88, 0x90, 0x89, 0x08, 0x90, 0x8a, 0x08, 0xa0, 0x5c,
+    0x07, 0x5c, 0x05, 0x40, 0xa2, 0x0a, 0x21, 0x22, 0x12, 0x21, 0x22, 0x21, 0x42, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0026
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x40, 0x19,
+    0xe3, 0x88, 0x58, 0x8c, 0xc8, 0xcc, 0x8c, 0x68, 0xc7, 0x0c, 0x31, 0x63, 0x93, 0xce, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0027
+    0x00, 0x03, 0x00, 0x38, 0x01, 0x80, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0028
+    0x00, 0x00, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x10, 0x02, 0x00, 0x20, 0x04, 0x00, 0x40, 0x04,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x20, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x40,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0029
+    0x00, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x20, 0x02,
+    0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x40, 0x04, 0x00, 0x80, 0x08, 0x01, 0x00, 0x20, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x20, 0x62, 0x37, 0x2f, 0x0b,
+    0x80, 0xf8, 0x3a, 0xe6, 0x23, 0x02, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02,
+    0x07, 0xff, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x38, 0x01, 0x80, 0x08, 0x01,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x38, 0x03, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+002F
+    0x00, 0x00, 0x02, 0x00, 0x60, 0x04, 0x00, 0xc0, 0x08, 0x00, 0x80, 0x10, 0x01, 0x00, 0x20, 0x02,
+    0x00, 0x60, 0x04, 0x00, 0x40, 0x08, 0x00, 0x80, 0x10, 0x01, 0x00, 0x30, 0x02, 0x00, 0x60, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0030
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x98, 0x30, 0xc3, 0x0c, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x30, 0xc3, 0x0c, 0x19, 0x80, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0031
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0032
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x18, 0x40, 0xc6, 0x0c, 0x60, 0xc0, 0x0c, 0x01,
+    0x80, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x80, 0x10, 0x42, 0x04, 0x60, 0x47, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0033
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x06, 0x30, 0x61, 0x86, 0x18, 0x01, 0x80, 0x18, 0x03,
+    0x00, 0xe0, 0x01, 0x80, 0x08, 0x00, 0xc0, 0x0c, 0x60, 0xc6, 0x0c, 0x61, 0x81, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0034
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x03, 0x80, 0x58, 0x05, 0x80, 0x98, 0x11,
+    0x81, 0x18, 0x21, 0x84, 0x18, 0x7f, 0xf0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x7e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0035
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc2, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x2f,
+    0x03, 0x18, 0x20, 0xc0, 0x0c, 0x00, 0xc6, 0x0c, 0x60, 0xc4, 0x18, 0x21, 0x81, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0036
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0x8c, 0x30, 0xc3, 0x00, 0x20, 0x06, 0x00, 0x67,
+    0x86, 0x8c, 0x70, 0x66, 0x06, 0x60, 0x66, 0x06, 0x20, 0x63, 0x04, 0x18, 0xc0, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0037
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe3, 0x06, 0x20, 0x42, 0x08, 0x00, 0x80, 0x18, 0x01,
+    0x00, 0x10, 0x02, 0x00, 0x20, 0x02, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0038
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0x0c, 0x60, 0x66, 0x06, 0x60, 0x63, 0x04, 0x38,
+    0x80, 0xf0, 0x13, 0x83, 0x0c, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x30, 0xc0, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0039
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x08, 0x30, 0xc6, 0x04, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x0e, 0x31, 0x61, 0xe6, 0x00, 0x60, 0x0c, 0x00, 0xc3, 0x08, 0x31, 0x81, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x02, 0x00,
+    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10,
+    0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003E
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00,
+    0x40, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+003F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc1, 0x86, 0x20, 0x32, 0x03, 0x30, 0x33, 0x03, 0x00,
+    0xe0, 0x18, 0x02, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0040
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0xc3, 0x04, 0x33, 0xa2, 0x6a, 0x66, 0xa6, 0x5a, 0x6d,
+    0x26, 0xd2, 0x6d, 0x26, 0xd2, 0x6d, 0x46, 0x78, 0x30, 0x23, 0x04, 0x18, 0xc0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0041
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x0a, 0x00, 0xb0, 0x09, 0x00, 0x90, 0x11,
+    0x81, 0x18, 0x10, 0x81, 0xf8, 0x20, 0xc2, 0x0c, 0x20, 0x44, 0x04, 0x40, 0x6f, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0042
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x1c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x31,
+    0x83, 0xf0, 0x30, 0xc3, 0x04, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0xc7, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0043
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc1, 0x8c, 0x30, 0x63, 0x02, 0x60, 0x26, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x02, 0x30, 0x23, 0x04, 0x18, 0xc0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0044
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x18, 0x30, 0xc3, 0x0c, 0x30, 0x63, 0x06, 0x30,
+    0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0xc3, 0x0c, 0x31, 0x8f, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0045
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x8c, 0x18, 0xc0, 0x4c, 0x04, 0xc0, 0x0c, 0x20, 0xc2,
+    0x0f, 0xe0, 0xc6, 0x0c, 0x20, 0xc2, 0x0c, 0x00, 0xc0, 0x4c, 0x04, 0xc0, 0x8f, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0046
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x0c, 0x60, 0x26, 0x02, 0x60, 0x06, 0x10, 0x61,
+    0x07, 0xf0, 0x61, 0x06, 0x10, 0x61, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0f, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0047
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x8c, 0x30, 0x43, 0x04, 0x20, 0x46, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x3f, 0x60, 0xc6, 0x0c, 0x30, 0xc3, 0x0c, 0x18, 0xc0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0048
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf6, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60,
+    0x67, 0xfe, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x6f, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0049
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x63, 0x06,
+    0x60, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x8c, 0x30, 0xc6, 0x0c, 0x40, 0xc8, 0x0d, 0x00, 0xd8,
+    0x0e, 0x80, 0xec, 0x0c, 0x40, 0xc6, 0x0c, 0x20, 0xc3, 0x0c, 0x10, 0xc1, 0x8e, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x26, 0x02, 0x60, 0x4f, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xcc, 0x38, 0xc3, 0x8e, 0x38, 0xe3, 0x8e, 0x58, 0xe5,
+    0x8a, 0x58, 0xb5, 0x8b, 0x58, 0xb9, 0x89, 0x98, 0x99, 0x89, 0x98, 0x91, 0x8d, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xf3, 0x04, 0x38, 0x43, 0x84, 0x2c, 0x42, 0xc4, 0x26,
+    0x42, 0x64, 0x22, 0x42, 0x34, 0x23, 0x42, 0x1c, 0x21, 0xc2, 0x0c, 0x20, 0xcf, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+004F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x98, 0x30, 0xc3, 0x0c, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x30, 0x43, 0x0c, 0x19, 0x80, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0050
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x0c, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x1c, 0x7f, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0f, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0051
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x98, 0x30, 0xc3, 0x04, 0x60, 0x66, 0x06, 0x60,
+    0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x66, 0xe6, 0x32, 0x43, 0x3c, 0x19, 0x80, 0xf8, 0x01, 0xe0,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0052
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x18, 0xc0, 0xcc, 0x0c, 0xc0, 0xcc, 0x0c, 0xc1,
+    0x8f, 0xe0, 0xc4, 0x0c, 0x60, 0xc3, 0x0c, 0x30, 0xc1, 0x8c, 0x18, 0xc0, 0xce, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0053
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x43, 0x0c, 0x60, 0x46, 0x04, 0x60, 0x07, 0x00, 0x3c,
+    0x01, 0xf0, 0x07, 0xc0, 0x1c, 0x00, 0xe4, 0x06, 0x40, 0x66, 0x06, 0x30, 0xc4, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0054
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe4, 0x62, 0x86, 0x18, 0x61, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x01, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0055
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xe3, 0x04, 0x30, 0x43, 0x04, 0x30, 0x43, 0x04, 0x30,
+    0x43, 0x04, 0x30, 0x43, 0x04, 0x30, 0x43, 0x04, 0x30, 0x43, 0x04, 0x18, 0x80, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0056
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xe6, 0x04, 0x20, 0x82, 0x08, 0x30, 0x83, 0x08, 0x11,
+    0x01, 0x10, 0x19, 0x01, 0x90, 0x0a, 0x00, 0xa0, 0x0e, 0x00, 0xc0, 0x04, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0057
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x74, 0x62, 0x42, 0x26, 0x22, 0x62, 0x22, 0x64, 0x26,
+    0x42, 0x74, 0x27, 0x43, 0x94, 0x39, 0x81, 0x98, 0x19, 0x81, 0x18, 0x11, 0x81, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0058
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe3, 0x08, 0x10, 0x81, 0x88, 0x09, 0x00, 0xd0, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x0b, 0x00, 0x90, 0x11, 0x81, 0x08, 0x20, 0xc7, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0059
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf6, 0x02, 0x20, 0x43, 0x04, 0x10, 0x81, 0x88, 0x1d,
+    0x00, 0xd0, 0x0e, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x01, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe3, 0x04, 0x60, 0xc4, 0x08, 0x01, 0x80, 0x10, 0x02,
+    0x00, 0x20, 0x04, 0x00, 0x40, 0x08, 0x01, 0x80, 0x10, 0x23, 0x02, 0x20, 0x47, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005B
+    0x00, 0x00, 0x7c, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00,
+    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005C
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80, 0x08, 0x00, 0x80, 0x04,
+    0x00, 0x40, 0x02, 0x00, 0x20, 0x03, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x40,
+    0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005D
+    0x00, 0x03, 0xe0, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02,
+    0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x03,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005E
+    0x06, 0x00, 0x90, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+005F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0060
+    0x00, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0061
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x30,
+    0xc3, 0x0c, 0x00, 0xc0, 0x7c, 0x38, 0xc7, 0x0c, 0x60, 0xc6, 0x0c, 0x71, 0xd3, 0xe6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0062
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x38, 0x3c,
+    0xc3, 0x86, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x04, 0x38, 0xc2, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0063
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x31,
+    0x83, 0x18, 0x61, 0x86, 0x00, 0x60, 0x06, 0x00, 0x60, 0x43, 0x04, 0x30, 0x80, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0064
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc1, 0xec, 0x31,
+    0xc3, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x31, 0xe1, 0xe8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0065
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x18,
+    0xc1, 0x04, 0x30, 0x63, 0x06, 0x3f, 0xe3, 0x00, 0x30, 0x01, 0x82, 0x1c, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0066
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x66, 0x0c, 0x60, 0xc0, 0x0c, 0x07, 0xf8, 0x0c,
+    0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x03, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0067
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x1b,
+    0x63, 0x18, 0x31, 0x83, 0x18, 0x19, 0x81, 0xf0, 0x30, 0x03, 0xf0, 0x37, 0xc6, 0x0c, 0x60, 0xc7,
+    0x1c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0068
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x78, 0x38,
+    0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0x9e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0069
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe0, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x38, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf8, 0x01,
+    0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x83,
+    0x30, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006B
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x1c, 0x31,
+    0x83, 0x10, 0x32, 0x03, 0x60, 0x3a, 0x03, 0x10, 0x31, 0x83, 0x08, 0x30, 0xc7, 0x9e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3e, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xcc, 0x77,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6f, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x38,
+    0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0x9e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+006F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x19,
+    0x83, 0x0c, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0x63, 0x0c, 0x38, 0x80, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0070
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x38,
+    0xc3, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x0c, 0x38, 0xc3, 0x78, 0x30, 0x03,
+    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0071
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x31,
+    0xc3, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x31, 0xc1, 0xec, 0x00, 0xc0,
+    0x0c, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0072
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9c, 0x1a,
+    0x61, 0xc6, 0x1c, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0f, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0073
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x38,
+    0xc3, 0x04, 0x30, 0x41, 0xc0, 0x0f, 0x00, 0x3c, 0x20, 0xc2, 0x0c, 0x31, 0xc3, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0074
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0xc0, 0x0c, 0x07, 0xf8, 0x0c,
+    0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc4, 0x0c, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0075
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x47, 0x1c, 0x30,
+    0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x39, 0xe1, 0xe8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0076
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8e, 0x30,
+    0x41, 0x08, 0x10, 0x81, 0x88, 0x09, 0x00, 0xd0, 0x0d, 0x00, 0x60, 0x06, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0077
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf7, 0x66,
+    0x26, 0x22, 0x26, 0x42, 0x64, 0x37, 0x43, 0x98, 0x19, 0x81, 0x98, 0x19, 0x81, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0078
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xde, 0x18,
+    0x80, 0x88, 0x0d, 0x00, 0x60, 0x06, 0x00, 0x70, 0x09, 0x01, 0x08, 0x10, 0xc7, 0x9e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+0079
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9e, 0x10,
+    0x81, 0x08, 0x10, 0x80, 0x90, 0x09, 0x00, 0xd0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x40, 0x04, 0x02,
+    0x40, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+007A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x21,
+    0x82, 0x30, 0x23, 0x00, 0x60, 0x04, 0x00, 0xc0, 0x18, 0x41, 0x84, 0x30, 0xc3, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+007B
+    0x00, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02,
+    0x00, 0x40, 0x02, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+007C
+    0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02,
+    0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00,
+    0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+007D
+    0x00, 0x03, 0x00, 0x18, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x04,
+    0x00, 0x20, 0x04, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+007E
+    0x38, 0x04, 0xc2, 0x43, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+2190
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x80, 0x00, 0x0f, 0x80,
+    0x00, 0x1f, 0xff, 0xfc, 0x07, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4E0D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3f, 0xff, 0xfc, 0x00, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0xd9, 0x80, 0x00, 0x98,
+    0x40, 0x01, 0x18, 0x30, 0x02, 0x18, 0x18, 0x04, 0x18, 0x0c, 0x08, 0x18, 0x0c, 0x30, 0x18, 0x04,
+    0x40, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4E2D
+    0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x1f,
+    0xff, 0xf8, 0x18, 0x10, 0x18, 0x18, 0x10, 0x18, 0x18, 0x10, 0x18, 0x18, 0x10, 0x18, 0x18, 0x10,
+    0x18, 0x18, 0x10, 0x18, 0x1f, 0xff, 0xf8, 0x18, 0x10, 0x18, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4E49
+    0x00, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x40, 0x00, 0x18, 0x60, 0x02, 0x08, 0xc0, 0x02,
+    0x00, 0xc0, 0x01, 0x00, 0xc0, 0x01, 0x00, 0x80, 0x00, 0x81, 0x80, 0x00, 0x81, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x62, 0x00, 0x00, 0x26, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+    0x00, 0x36, 0x00, 0x00, 0x63, 0x00, 0x00, 0x81, 0xc0, 0x03, 0x00, 0xf0, 0x0c, 0x00, 0x3e, 0x30,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4EA4
+    0x00, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x08, 0x7f, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x80, 0xc0, 0x02, 0x00, 0x70, 0x04, 0x01, 0xb8, 0x18, 0x83,
+    0x18, 0x20, 0x83, 0x00, 0x00, 0x42, 0x00, 0x00, 0x46, 0x00, 0x00, 0x24, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xc6, 0x00, 0x01, 0x83, 0xc0, 0x0e, 0x00, 0x7c, 0x20,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4F4F
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x86, 0x00, 0x03, 0x03, 0x00, 0x02, 0x03, 0x00, 0x06,
+    0x00, 0x08, 0x04, 0xff, 0xfc, 0x0c, 0x02, 0x00, 0x0c, 0x02, 0x00, 0x14, 0x02, 0x00, 0x24, 0x02,
+    0x00, 0x24, 0x02, 0x10, 0x44, 0x7f, 0xf8, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00,
+    0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x08, 0x05, 0xff, 0xfc, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4F53
+    0x02, 0x02, 0x00, 0x03, 0x03, 0x00, 0x02, 0x02, 0x00, 0x06, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04,
+    0xff, 0xfc, 0x08, 0x06, 0x80, 0x0e, 0x0e, 0x80, 0x14, 0x0a, 0x80, 0x14, 0x1a, 0x40, 0x24, 0x12,
+    0x40, 0x44, 0x12, 0x60, 0x04, 0x22, 0x20, 0x04, 0x62, 0x30, 0x04, 0x42, 0x18, 0x04, 0x82, 0x2c,
+    0x05, 0x3f, 0xfc, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x04,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+4FE1
+    0x01, 0x04, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x06, 0x03, 0x08, 0x04, 0xff, 0xfc, 0x04,
+    0x00, 0x00, 0x08, 0x00, 0x10, 0x0c, 0x7f, 0xf8, 0x14, 0x00, 0x00, 0x14, 0x00, 0x10, 0x24, 0x7f,
+    0xf8, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x3f, 0xf8, 0x04, 0x20, 0x10,
+    0x04, 0x20, 0x10, 0x04, 0x20, 0x10, 0x04, 0x20, 0x10, 0x04, 0x3f, 0xf0, 0x04, 0x20, 0x10, 0x04,
+    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+50CF
+    0x02, 0x08, 0x00, 0x03, 0x18, 0x00, 0x02, 0x1f, 0xc0, 0x06, 0x30, 0xc0, 0x04, 0x60, 0x80, 0x0c,
+    0x7f, 0xf8, 0x0c, 0xa3, 0x18, 0x0c, 0x22, 0x18, 0x14, 0x7f, 0xf8, 0x24, 0x66, 0x10, 0x24, 0x04,
+    0x00, 0x44, 0x0a, 0x30, 0x04, 0x32, 0xc0, 0x04, 0xc5, 0x40, 0x04, 0x09, 0x40, 0x04, 0x33, 0xa0,
+    0x04, 0xc6, 0xb0, 0x04, 0x08, 0x90, 0x04, 0x30, 0x9c, 0x04, 0xc1, 0x8e, 0x05, 0x0f, 0x00, 0x08,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5178
+    0x00, 0x44, 0x00, 0x00, 0x66, 0x00, 0x00, 0x44, 0x00, 0x00, 0x44, 0x00, 0x07, 0xff, 0xe0, 0x04,
+    0x44, 0x60, 0x04, 0x44, 0x60, 0x04, 0x44, 0x60, 0x04, 0x44, 0x60, 0x07, 0xff, 0xe0, 0x04, 0x44,
+    0x60, 0x04, 0x44, 0x60, 0x04, 0x44, 0x60, 0x04, 0x44, 0x60, 0x04, 0x44, 0x68, 0x7f, 0xff, 0xfc,
+    0x00, 0x80, 0x00, 0x01, 0xc1, 0x00, 0x03, 0x80, 0xc0, 0x06, 0x00, 0x30, 0x08, 0x00, 0x18, 0x30,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+53D6
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7f, 0xf0, 0x00, 0x08, 0x40, 0x00, 0x08, 0x5f, 0xf8, 0x08,
+    0x44, 0x18, 0x0f, 0xc4, 0x10, 0x08, 0x44, 0x30, 0x08, 0x42, 0x30, 0x08, 0x42, 0x20, 0x08, 0x42,
+    0x20, 0x0f, 0xc2, 0x60, 0x08, 0x41, 0x40, 0x08, 0x41, 0x40, 0x08, 0x59, 0x80, 0x09, 0xe1, 0x80,
+    0x7e, 0x41, 0x40, 0x30, 0x42, 0x60, 0x00, 0x46, 0x38, 0x00, 0x4c, 0x1e, 0x00, 0x50, 0x08, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+56DE
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0xff, 0xf8, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18,
+    0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0xff, 0x98, 0x18, 0x81, 0x18, 0x18, 0x81, 0x18, 0x18, 0x81,
+    0x18, 0x18, 0x81, 0x18, 0x18, 0x81, 0x18, 0x18, 0xff, 0x18, 0x18, 0x81, 0x18, 0x18, 0x80, 0x18,
+    0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x1f, 0xff, 0xf8, 0x18, 0x00, 0x18, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5730
+    0x00, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x0c, 0x01, 0x00, 0x0c, 0x21, 0x00, 0x0c, 0x31, 0x00, 0x0c,
+    0x31, 0x10, 0x0c, 0x31, 0x78, 0x0c, 0x31, 0x90, 0x7f, 0xbf, 0x10, 0x0c, 0x71, 0x10, 0x0d, 0xb1,
+    0x10, 0x0c, 0x33, 0x10, 0x0c, 0x33, 0x10, 0x0c, 0x33, 0x10, 0x0c, 0x33, 0x70, 0x0c, 0x33, 0x34,
+    0x0d, 0xb3, 0x04, 0x0e, 0x30, 0x04, 0x78, 0x30, 0x04, 0x20, 0x30, 0x06, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5904
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x06,
+    0x01, 0x00, 0x07, 0xf9, 0x00, 0x04, 0x11, 0xc0, 0x04, 0x31, 0x30, 0x0c, 0x31, 0x18, 0x0c, 0x21,
+    0x0c, 0x14, 0x21, 0x04, 0x12, 0x61, 0x00, 0x22, 0x41, 0x00, 0x21, 0x41, 0x00, 0x01, 0xc1, 0x00,
+    0x00, 0x81, 0x00, 0x01, 0xc1, 0x00, 0x02, 0x70, 0x00, 0x04, 0x1f, 0x00, 0x18, 0x07, 0xfc, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5B57
+    0x00, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x08, 0x08, 0x08, 0x0f, 0xff, 0xfc, 0x08,
+    0x00, 0x18, 0x18, 0x00, 0x10, 0x37, 0xff, 0xe0, 0x00, 0x01, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5BBF
+    0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x1f, 0xff, 0xfc, 0x10, 0x00, 0x18, 0x33,
+    0x80, 0x10, 0x33, 0x7f, 0xfc, 0x02, 0x03, 0x00, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x0e, 0x02,
+    0x00, 0x0c, 0x3f, 0xf0, 0x14, 0x30, 0x30, 0x24, 0x30, 0x30, 0x44, 0x30, 0x30, 0x04, 0x3f, 0xf0,
+    0x04, 0x30, 0x30, 0x04, 0x30, 0x30, 0x04, 0x30, 0x30, 0x04, 0x3f, 0xf0, 0x04, 0x30, 0x30, 0x04,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5C42
+    0x0f, 0xff, 0xf0, 0x0c, 0x00, 0x18, 0x0c, 0x00, 0x10, 0x0c, 0x00, 0x10, 0x0f, 0xff, 0xf0, 0x0c,
+    0x00, 0x10, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0xff, 0xf0, 0x0c, 0x00, 0x00, 0x0c, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x0b, 0xff, 0xfc, 0x08, 0x0c, 0x00, 0x08, 0x0c, 0x00, 0x18, 0x18, 0x80,
+    0x10, 0x30, 0x40, 0x10, 0x40, 0x20, 0x20, 0x81, 0xf0, 0x21, 0xfe, 0x18, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+5E78
+    0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x40, 0x07, 0xff, 0xe0, 0x00, 0x18, 0x00, 0x00,
+    0x18, 0x08, 0x3f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xc1, 0x80, 0x00, 0x42,
+    0x00, 0x00, 0x42, 0x20, 0x0f, 0xff, 0xf0, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x08,
+    0x7f, 0xff, 0xfc, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6027
+    0x04, 0x01, 0x00, 0x04, 0x01, 0x80, 0x04, 0x11, 0x00, 0x04, 0x19, 0x00, 0x04, 0x31, 0x00, 0x06,
+    0x31, 0x08, 0x05, 0xbf, 0xfc, 0x15, 0xa1, 0x00, 0x24, 0x41, 0x00, 0x24, 0x41, 0x00, 0x64, 0x81,
+    0x00, 0x04, 0x81, 0x00, 0x04, 0x3f, 0xf8, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+    0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x04, 0x04, 0xff, 0xfe, 0x04, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+61BE
+    0x08, 0x01, 0x80, 0x0c, 0x00, 0xb0, 0x08, 0x00, 0x90, 0x08, 0xff, 0xfc, 0x0c, 0x80, 0x80, 0x0a,
+    0x80, 0x90, 0x2b, 0xfe, 0x98, 0x28, 0x80, 0x90, 0x28, 0x80, 0xb0, 0x68, 0xbe, 0xe0, 0x08, 0xa2,
+    0x44, 0x08, 0xbe, 0xe4, 0x09, 0x21, 0xb4, 0x09, 0x02, 0x1c, 0x0a, 0x04, 0x0c, 0x08, 0x06, 0x02,
+    0x08, 0x93, 0x10, 0x08, 0x90, 0x4c, 0x09, 0x90, 0x44, 0x0b, 0x10, 0x44, 0x08, 0x1f, 0xc0, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+641C
+    0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x04, 0x3d, 0x00, 0x04, 0x21, 0x7c, 0x04, 0x21, 0x08, 0x7f,
+    0xa1, 0x08, 0x04, 0x3d, 0x78, 0x04, 0x21, 0x08, 0x04, 0x21, 0x08, 0x04, 0xa1, 0x08, 0x07, 0x3f,
+    0xf8, 0x0c, 0x21, 0x08, 0x34, 0x01, 0x00, 0x64, 0x7f, 0xf0, 0x04, 0x08, 0x30, 0x04, 0x08, 0x60,
+    0x04, 0x04, 0x40, 0x04, 0x02, 0x80, 0x04, 0x03, 0x00, 0x04, 0x06, 0xc0, 0x1c, 0x38, 0x7e, 0x00,
+    0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6587
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x08, 0x3f,
+    0xff, 0xfc, 0x01, 0x01, 0x80, 0x01, 0x01, 0x80, 0x00, 0x81, 0x00, 0x00, 0x83, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x42, 0x00, 0x00, 0x46, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x66, 0x00, 0x00, 0xc3, 0x80, 0x03, 0x01, 0xf0, 0x0c, 0x00, 0x7c, 0x30,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6700
+    0x00, 0x00, 0x40, 0x03, 0xff, 0xe0, 0x02, 0x00, 0x60, 0x03, 0xff, 0xe0, 0x02, 0x00, 0x60, 0x02,
+    0x00, 0x60, 0x03, 0xff, 0xe0, 0x02, 0x00, 0x60, 0x00, 0x00, 0x08, 0x7f, 0xff, 0xfc, 0x0c, 0x20,
+    0x00, 0x0f, 0xe0, 0x00, 0x0c, 0x2f, 0xf8, 0x0c, 0x22, 0x10, 0x0f, 0xe2, 0x30, 0x0c, 0x22, 0x20,
+    0x0c, 0x2d, 0x40, 0x0c, 0xf0, 0xc0, 0x3f, 0x21, 0xc0, 0x30, 0x23, 0x30, 0x00, 0x24, 0x1c, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6761
+    0x00, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x01, 0xff, 0xc0, 0x01, 0x80, 0xc0, 0x02, 0x41, 0x80, 0x04,
+    0x43, 0x00, 0x0c, 0x26, 0x00, 0x10, 0x1c, 0x00, 0x20, 0x1c, 0x00, 0x00, 0x67, 0x00, 0x03, 0x89,
+    0xfe, 0x3c, 0x08, 0x78, 0x00, 0x08, 0x20, 0x0f, 0xff, 0xf0, 0x00, 0x08, 0x00, 0x01, 0x89, 0x00,
+    0x01, 0x88, 0x80, 0x03, 0x08, 0x60, 0x06, 0x08, 0x30, 0x08, 0x98, 0x18, 0x30, 0x78, 0x18, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+679C
+    0x07, 0xff, 0xe0, 0x04, 0x18, 0x30, 0x04, 0x18, 0x20, 0x04, 0x18, 0x20, 0x07, 0xff, 0xe0, 0x04,
+    0x18, 0x20, 0x04, 0x18, 0x20, 0x04, 0x18, 0x20, 0x07, 0xff, 0xe0, 0x04, 0x18, 0x20, 0x00, 0x18,
+    0x08, 0x3f, 0xff, 0xfc, 0x00, 0x38, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xda, 0x00, 0x01, 0x99, 0x00,
+    0x03, 0x18, 0xc0, 0x04, 0x18, 0x70, 0x18, 0x18, 0x3e, 0x20, 0x18, 0x08, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6B21
+    0x00, 0x0c, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x0c, 0x00, 0x0c, 0x08, 0x00, 0x04, 0x98, 0x00, 0x05,
+    0x1f, 0xfc, 0x01, 0x10, 0x08, 0x01, 0x22, 0x10, 0x02, 0x23, 0x20, 0x02, 0x43, 0x00, 0x04, 0x83,
+    0x00, 0x04, 0x07, 0x00, 0x08, 0x06, 0x80, 0x38, 0x04, 0x80, 0x18, 0x04, 0x80, 0x08, 0x0c, 0x40,
+    0x08, 0x08, 0x40, 0x18, 0x10, 0x20, 0x18, 0x20, 0x30, 0x18, 0x40, 0x1c, 0x01, 0x80, 0x0e, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6BCF
+    0x01, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x10, 0x07, 0xff, 0xf8, 0x04, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x1b, 0xff, 0xe0, 0x12, 0x20, 0x60, 0x22, 0x18, 0x60, 0x02, 0x08, 0x60, 0x02, 0x08,
+    0x60, 0x7f, 0xff, 0xfc, 0x06, 0x00, 0x60, 0x06, 0x30, 0x40, 0x06, 0x18, 0x40, 0x04, 0x08, 0x40,
+    0x04, 0x08, 0x48, 0x0f, 0xff, 0xfc, 0x04, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x00, 0x07, 0xc0, 0x00,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6C47
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04, 0x3f, 0xfc, 0x04, 0x20, 0x00, 0x00,
+    0xa0, 0x00, 0x40, 0xa0, 0x00, 0x21, 0x20, 0x00, 0x31, 0x20, 0x00, 0x12, 0x20, 0x00, 0x12, 0x20,
+    0x00, 0x02, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x08, 0x20, 0x00,
+    0x38, 0x20, 0x00, 0x18, 0x20, 0x00, 0x18, 0x20, 0x00, 0x18, 0x20, 0x00, 0x18, 0x7f, 0xfc, 0x18,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6C9F
+    0x00, 0x08, 0x00, 0x18, 0x08, 0x00, 0x0c, 0x18, 0x00, 0x04, 0x10, 0x00, 0x00, 0x1f, 0xfc, 0x40,
+    0xa0, 0x08, 0x21, 0x20, 0x08, 0x31, 0x44, 0x08, 0x12, 0x4c, 0x08, 0x12, 0x88, 0x08, 0x02, 0x08,
+    0x08, 0x04, 0x12, 0x08, 0x04, 0x11, 0x08, 0x0c, 0x20, 0x88, 0x08, 0x63, 0xc8, 0x38, 0x7c, 0xd8,
+    0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x03, 0x10, 0x18, 0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+6D41
+    0x00, 0x08, 0x00, 0x10, 0x06, 0x00, 0x0c, 0x02, 0x08, 0x06, 0xff, 0xfc, 0x06, 0x06, 0x00, 0x00,
+    0x8c, 0x00, 0x01, 0x08, 0x40, 0x61, 0x10, 0x20, 0x31, 0x61, 0xf0, 0x12, 0x7e, 0x10, 0x12, 0x00,
+    0x10, 0x02, 0x66, 0x60, 0x04, 0x64, 0x40, 0x04, 0x64, 0x40, 0x0c, 0x64, 0x40, 0x78, 0x64, 0x40,
+    0x18, 0x44, 0x40, 0x18, 0x44, 0x44, 0x18, 0xc4, 0x44, 0x18, 0x84, 0x46, 0x19, 0x04, 0x7c, 0x06,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+70ED
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x03, 0x0f, 0xf0, 0x3f,
+    0xe2, 0x20, 0x03, 0x02, 0x20, 0x03, 0x06, 0x20, 0x03, 0x76, 0x20, 0x03, 0x8c, 0x20, 0x0f, 0x06,
+    0x24, 0x33, 0x09, 0x24, 0x23, 0x19, 0xb4, 0x03, 0x10, 0x1c, 0x0b, 0x20, 0x0c, 0x06, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x84, 0x20, 0x08, 0x42, 0x10, 0x18, 0x43, 0x18, 0x18, 0x63, 0x08, 0x30,
+    0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7406
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf8, 0x7f, 0x91, 0x08, 0x04, 0x11, 0x08, 0x04,
+    0x11, 0x08, 0x04, 0x11, 0x08, 0x04, 0x1f, 0xf8, 0x04, 0x11, 0x08, 0x04, 0x91, 0x08, 0x3f, 0x91,
+    0x08, 0x04, 0x1f, 0xf8, 0x04, 0x11, 0x08, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,
+    0x05, 0xbf, 0xf8, 0x0e, 0x01, 0x00, 0x78, 0x01, 0x00, 0x20, 0x01, 0x04, 0x01, 0xff, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7701
+    0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x03, 0x10, 0x40, 0x02, 0x11, 0x30, 0x06, 0x11, 0x98, 0x0c,
+    0x17, 0x0c, 0x10, 0x1c, 0x04, 0x20, 0x18, 0x00, 0x00, 0x20, 0x00, 0x01, 0xff, 0xe0, 0x01, 0x80,
+    0x40, 0x07, 0x00, 0x40, 0x19, 0x00, 0x40, 0x61, 0xff, 0xc0, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40,
+    0x01, 0xff, 0xc0, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0xff, 0xe0, 0x01, 0x00, 0x60, 0x01,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+79D2
+    0x00, 0x00, 0x80, 0x00, 0xc0, 0x80, 0x0f, 0x80, 0x80, 0x12, 0x00, 0x80, 0x02, 0x00, 0xa0, 0x02,
+    0x0c, 0x90, 0x02, 0x0c, 0x88, 0x7f, 0xc8, 0x8c, 0x06, 0x08, 0x84, 0x06, 0x18, 0x84, 0x07, 0x90,
+    0x80, 0x0a, 0xd0, 0x88, 0x0a, 0xe0, 0x9c, 0x12, 0x00, 0x98, 0x22, 0x00, 0xb0, 0x22, 0x00, 0x60,
+    0x02, 0x00, 0xc0, 0x02, 0x01, 0x80, 0x02, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x02, 0x70, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7D20
+    0x00, 0x18, 0x00, 0x00, 0x18, 0x10, 0x1f, 0xff, 0xf8, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x07,
+    0xff, 0xe0, 0x00, 0x18, 0x00, 0x7f, 0xff, 0xfc, 0x00, 0x60, 0x00, 0x01, 0x83, 0x00, 0x06, 0x36,
+    0x00, 0x03, 0xc8, 0x00, 0x00, 0x31, 0x80, 0x00, 0xc0, 0xc0, 0x07, 0x7f, 0xe0, 0x07, 0x98, 0x20,
+    0x01, 0x19, 0x00, 0x03, 0x98, 0xc0, 0x06, 0x18, 0x70, 0x0c, 0x98, 0x38, 0x10, 0x78, 0x18, 0x20,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7D22
+    0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x10, 0x1f, 0xff, 0xf0, 0x00, 0x18, 0x00, 0x10,
+    0x18, 0x00, 0x1f, 0xff, 0xfc, 0x10, 0x30, 0x08, 0x30, 0x61, 0x10, 0x20, 0x83, 0x80, 0x07, 0xfc,
+    0x00, 0x02, 0x19, 0x00, 0x00, 0x20, 0xc0, 0x00, 0xc0, 0x60, 0x03, 0x3f, 0xb0, 0x07, 0xc8, 0x30,
+    0x04, 0x08, 0x00, 0x01, 0x89, 0x80, 0x03, 0x08, 0x70, 0x0c, 0x08, 0x38, 0x30, 0x78, 0x18, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7ED3
+    0x00, 0x01, 0x00, 0x07, 0x01, 0x80, 0x06, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x08,
+    0xbf, 0xfc, 0x10, 0xc1, 0x00, 0x11, 0x81, 0x00, 0x21, 0x01, 0x00, 0x3e, 0x1f, 0xf8, 0x02, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x11, 0xdf, 0xf8, 0x3e, 0x18, 0x18, 0x10, 0x18, 0x18,
+    0x00, 0x18, 0x18, 0x01, 0xd8, 0x18, 0x0e, 0x18, 0x18, 0x38, 0x1f, 0xf8, 0x20, 0x18, 0x18, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+7EDF
+    0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x06, 0x01, 0x80, 0x04, 0x3f, 0xfc, 0x08, 0x03, 0x00, 0x18,
+    0xc3, 0x00, 0x10, 0x84, 0x00, 0x3f, 0x04, 0x20, 0x23, 0x08, 0x18, 0x06, 0x13, 0xfc, 0x0c, 0x3c,
+    0x4c, 0x08, 0x06, 0x40, 0x37, 0x84, 0x40, 0x38, 0x04, 0x40, 0x00, 0x04, 0x40, 0x00, 0x04, 0x40,
+    0x03, 0x84, 0x44, 0x3c, 0x0c, 0x44, 0x30, 0x08, 0x44, 0x00, 0x10, 0x46, 0x00, 0x60, 0x7c, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+80FD
+    0x02, 0x00, 0x00, 0x03, 0x03, 0x00, 0x06, 0x02, 0x10, 0x04, 0x42, 0x38, 0x08, 0x22, 0x60, 0x30,
+    0xf3, 0x80, 0x3f, 0x12, 0x00, 0x00, 0x02, 0x04, 0x1f, 0xe2, 0x04, 0x18, 0x63, 0xfc, 0x18, 0x60,
+    0x00, 0x1f, 0xe0, 0x00, 0x18, 0x62, 0x10, 0x18, 0x62, 0x38, 0x18, 0x62, 0x40, 0x1f, 0xe3, 0x00,
+    0x18, 0x62, 0x00, 0x18, 0x62, 0x04, 0x18, 0x62, 0x04, 0x18, 0x62, 0x06, 0x19, 0xe3, 0xfc, 0x10,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+81B3
+    0x00, 0x08, 0x40, 0x1f, 0x0c, 0x60, 0x11, 0x04, 0x40, 0x11, 0x7f, 0xfc, 0x11, 0x01, 0x00, 0x11,
+    0x01, 0x10, 0x1f, 0x3f, 0xf0, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x11, 0xff, 0xfc, 0x11, 0x01,
+    0x30, 0x11, 0x19, 0x30, 0x1f, 0x09, 0x44, 0x11, 0xff, 0xfc, 0x11, 0x00, 0x00, 0x31, 0x1f, 0xf0,
+    0x21, 0x10, 0x10, 0x21, 0x10, 0x10, 0x21, 0x10, 0x10, 0x21, 0x1f, 0xf0, 0x47, 0x10, 0x10, 0x42,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+82F1
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x81, 0x08, 0x7f, 0xff, 0xfc, 0x00, 0x81, 0x00, 0x00,
+    0x99, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x07, 0xff, 0xe0, 0x04, 0x10, 0x40, 0x04, 0x10,
+    0x40, 0x04, 0x10, 0x40, 0x04, 0x10, 0x40, 0x04, 0x10, 0x40, 0x7f, 0xff, 0xfc, 0x00, 0x34, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x63, 0x00, 0x00, 0xc1, 0x80, 0x01, 0x80, 0x70, 0x0e, 0x00, 0x3e, 0x30,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+8BA1
+    0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02, 0x03, 0x00, 0x02, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x7e, 0x03, 0x04, 0x04, 0xff, 0xfe, 0x04, 0x03,
+    0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x00, 0x04, 0x03, 0x00, 0x04, 0x43, 0x00,
+    0x04, 0x83, 0x00, 0x05, 0x03, 0x00, 0x07, 0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+8BCD
+    0x00, 0x00, 0x00, 0x08, 0x7f, 0xf8, 0x0c, 0x00, 0x0c, 0x06, 0x00, 0x08, 0x04, 0x00, 0x08, 0x00,
+    0x00, 0x08, 0x00, 0xff, 0xc8, 0x00, 0x00, 0x08, 0x7c, 0x00, 0x08, 0x04, 0x3f, 0x88, 0x04, 0x21,
+    0x08, 0x04, 0x21, 0x08, 0x04, 0x21, 0x08, 0x04, 0x21, 0x08, 0x04, 0x3f, 0x08, 0x04, 0x21, 0x08,
+    0x05, 0xa1, 0x08, 0x07, 0x00, 0x08, 0x06, 0x00, 0x08, 0x04, 0x00, 0x88, 0x04, 0x00, 0x78, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+8BFB
+    0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x08, 0x02, 0x00, 0x0c, 0xff, 0xf0, 0x04, 0x02, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x0c, 0x7c, 0x21, 0x10, 0x08, 0x19, 0x90, 0x08, 0x09,
+    0x80, 0x08, 0x41, 0x80, 0x08, 0x31, 0x80, 0x08, 0x11, 0x80, 0x08, 0x11, 0x00, 0x08, 0xff, 0xfc,
+    0x08, 0x01, 0x00, 0x09, 0x83, 0x00, 0x0a, 0x06, 0xc0, 0x0c, 0x0c, 0x30, 0x00, 0x30, 0x18, 0x00,
+    0xc0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+8FD1
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x08, 0x01, 0xf0, 0x0c, 0x3c, 0x00, 0x04, 0x20, 0x00, 0x04,
+    0x20, 0x00, 0x00, 0x20, 0x00, 0x04, 0x20, 0x00, 0x7e, 0x3f, 0xfc, 0x04, 0x20, 0xc0, 0x04, 0x20,
+    0xc0, 0x04, 0x20, 0xc0, 0x04, 0x20, 0xc0, 0x04, 0x20, 0xc0, 0x04, 0x60, 0xc0, 0x04, 0x40, 0xc0,
+    0x04, 0x80, 0xc0, 0x0a, 0x80, 0xc0, 0x31, 0x00, 0xc0, 0x60, 0xf0, 0x1e, 0x00, 0x3f, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+8FD4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0xf0, 0x04, 0x34, 0x00, 0x06, 0x20, 0x00, 0x04,
+    0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x20, 0x30, 0x7e, 0x20, 0x20, 0x04, 0x28,
+    0x60, 0x04, 0x64, 0x40, 0x04, 0x63, 0xc0, 0x04, 0x41, 0xc0, 0x04, 0x41, 0x60, 0x04, 0x82, 0x30,
+    0x04, 0x84, 0x18, 0x05, 0x18, 0x08, 0x0e, 0x60, 0x00, 0x11, 0x00, 0x00, 0x60, 0xff, 0xfe, 0x20,
+    0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+901A
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x10, 0x00, 0x30, 0x08, 0x08, 0xc0, 0x0c, 0x07, 0x00, 0x0c,
+    0x03, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x7c, 0x7f, 0xf8, 0x04, 0x42,
+    0x08, 0x04, 0x42, 0x08, 0x04, 0x42, 0x08, 0x04, 0x7f, 0xf8, 0x04, 0x42, 0x08, 0x04, 0x42, 0x08,
+    0x04, 0x42, 0x08, 0x04, 0x42, 0x58, 0x1a, 0x42, 0x38, 0x31, 0x80, 0x00, 0x60, 0xff, 0xfe, 0x00,
+    0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+9057
+    0x00, 0x03, 0x00, 0x10, 0x02, 0x00, 0x08, 0x7f, 0xf0, 0x0c, 0x62, 0x10, 0x04, 0x62, 0x10, 0x00,
+    0x7f, 0xf0, 0x00, 0x62, 0x10, 0x00, 0x02, 0x00, 0x01, 0xff, 0xfc, 0x7e, 0x00, 0x00, 0x04, 0x7f,
+    0xf0, 0x04, 0x20, 0x10, 0x04, 0x22, 0x10, 0x04, 0x22, 0x10, 0x04, 0x22, 0x10, 0x04, 0x66, 0x10,
+    0x04, 0x05, 0x80, 0x04, 0x08, 0x70, 0x1a, 0x70, 0x30, 0x71, 0x00, 0x10, 0x20, 0xf8, 0x0e, 0x00,
+    0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+91CA
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0f, 0xdf, 0xf0, 0x72, 0x08, 0x30, 0x02, 0xc4, 0x20, 0x12,
+    0x84, 0x40, 0x1b, 0x02, 0xc0, 0x12, 0x01, 0x80, 0x7f, 0xe3, 0x80, 0x06, 0x04, 0x70, 0x06, 0x19,
+    0x1c, 0x0f, 0xe1, 0x00, 0x0a, 0xdf, 0xf0, 0x1a, 0x41, 0x00, 0x12, 0x01, 0x00, 0x22, 0x7f, 0xfc,
+    0x42, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+95E8
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x9f, 0xf8, 0x01, 0x80, 0x18, 0x08,
+    0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00,
+    0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18,
+    0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x00, 0x18, 0x08, 0x01, 0x98, 0x08, 0x00, 0x70, 0x08,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+FF1B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,614 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DisplayFlush.h"
+
+#define PANEL_W         320
+#define PANEL_H         240
+#define LINE_BYTES      (PANEL_W * 2)
+#define SPI_HZ          20000000ULL     // SPI_FREQUENCY in platformio.ini
+#define WINDOW_BYTES    11              // CASET, RASET, RAMWR per flush
+#define FRAMES          60
+
+// Mock SPI backend on a simulated clock: a transfer started at t ends at
+// t + its bit time, dmaWait() advances the clock to that point
+static uint64_t nowNs;
+static uint64_t doneNs;
+static int busyCalls;
+static int waitCalls;
+static int endCalls;
+
+static bool mockBusy() {
+    busyCalls++;
+    return nowNs < doneNs;
+}
+
+static void mockWait() {
+    waitCalls++;
+    if (nowNs < doneNs) nowNs = doneNs;
+}
+
+static void mockEnd() {
+    endCalls++;
+}
+
+static const flush_bus_t mockBus = { mockBusy, mockWait, mockEnd };
+
+static uint64_t transferNs(uint32_t pixels) {
+    return (pixels * 2ULL + WINDOW_BYTES) * 8 * 1000000000ULL / SPI_HZ;
+}
+
+static void resetBus() {
+    nowNs = 0;
+    doneNs = 0;
+    busyCalls = 0;
+    waitCalls = 0;
+    endCalls = 0;
+}
+
+// LVGL 8.3's partial refresh over the BSP flush path. One buffer: a stripe
+// is only rendered once the previous flush released the buffer. Two
+// buffers: the next stripe renders while the last one is on the bus, and
+// draw_buf_flush() waits in wait_cb before handing over the next. Returns
+// frames per second; *overlaps counts renders into a buffer still in flight.
+static double runPipeline(int buffers, uint32_t lines, uint32_t renderNsPerPx, int* overlaps) {
+    FlushTracker tracker(&mockBus);
+    int bufIds[2] = {0, 1};
+    int inFlight = -1;
+    int cur = 0;
+    int flushes = 0;
+    int released = 0;
+    *overlaps = 0;
+    resetBus();
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        for (uint32_t y = 0; y < PANEL_H; y += lines) {
+            uint32_t h = PANEL_H - y < lines ? PANEL_H - y : lines;
+            flush_job_t done;
+
+            if (buffers == 1 && tracker.isPending()) {
+                // lv_refr_area_part(): wait_cb until the buffer is free
+                if (tracker.complete(true, &done)) {
+                    inFlight = -1;
+                    released++;
+                }
+            }
+            if (inFlight == cur) (*overlaps)++;
+            nowNs += (uint64_t)PANEL_W * h * renderNsPerPx;
+
+            if (buffers == 2 && tracker.isPending()) {
+                // draw_buf_flush(): wait_cb until the other buffer is free
+                if (tracker.complete(true, &done)) {
+                    inFlight = -1;
+                    released++;
+                }
+            }
+
+            // bsp_display_flush(): start the transfer and return
+            doneNs = nowNs + transferNs(PANEL_W * h);
+            flush_job_t job = { &bufIds[cur], (uint32_t)(nowNs / 1000), PANEL_W * h, 1 };
+            tracker.start(job);
+            inFlight = cur;
+            flushes++;
+            if (buffers == 2) cur ^= 1;
+        }
+        // The LVGL task polls after lv_timer_handler()
+        flush_job_t done;
+        if (tracker.complete(false, &done)) {
+            inFlight = -1;
+            released++;
+        }
+    }
+    flush_job_t done;
+    if (tracker.complete(true, &done)) {
+        released++;
+    }
+
+    TEST_ASSERT_EQUAL_INT(flushes, released);
+    TEST_ASSERT_EQUAL_INT(flushes, endCalls);
+    TEST_ASSERT_FALSE(tracker.isPending());
+    return FRAMES * 1e9 / nowNs;
+}
+
+// Mock TFT behind pushRun(): keeps what the panel shows and counts what
+// crossed the bus
+static uint16_t panel[PANEL_H * PANEL_W];
+static uint32_t busBytes;
+static uint32_t busWindows;
+
+static void mockPush(int16_t x, int16_t y, uint32_t w, uint32_t h, uint16_t* px) {
+    for (uint32_t r = 0; r < h; r++) {
+        memcpy(&panel[(y + r) * PANEL_W + x], px + r * w, w * sizeof(uint16_t));
+    }
+    busBytes += w * h * sizeof(uint16_t) + WINDOW_BYTES;
+    busWindows++;
+}
+
+// A chat screen: grey sidebar, black list, white bubbles holding lines of
+// text. scroll moves the list up, chars is how much of the last bubble's
+// reply has streamed in.
+static uint16_t screen[PANEL_H * PANEL_W];
+
+static void drawChat(int scroll, int chars) {
+    for (int y = 0; y < PANEL_H; y++) {
+        for (int x = 0; x < PANEL_W; x++) {
+            uint16_t c = x < 40 ? 0x8410 : 0x0000;
+            int ly = y + scroll;
+            int bubble = ly / 80;
+            int by = ly % 80;
+            bool last = bubble == (PANEL_H - 1 + scroll) / 80;
+            if (x >= 52 && x < 308 && by >= 8 && by < 72) {
+                c = 0xFFFF;
+                int line = (by - 12) / 20;
+                int col = (x - 60) / 12;
+                int glyphRow = (by - 12) % 20;
+                int pos = line * 20 + col;
+                bool inText = by >= 12 && line < 3 && x >= 60 && col < 20 && glyphRow < 16;
+                if (inText && (!last || pos < chars)) {
+                    // Stroke pixels vary per glyph, like rendered text
+                    unsigned h = (bubble * 977 + pos * 131 + glyphRow * 17 + (x - 60) % 12) * 2654435761u;
+                    if ((h >> 28) < 5) c = 0x0000;
+                }
+            }
+            screen[y * PANEL_W + x] = c;
+        }
+    }
+}
+
+// LVGL redraws the invalid area in stripes of the draw buffer height
+static void flushArea(FlushFilter& filter, int x1, int y1, int x2, int y2, uint32_t lines,
+                      uint32_t* plainBytes, uint32_t* scannedBytes) {
+    static uint16_t buf[PANEL_W * 48];
+    int w = x2 - x1 + 1;
+    for (int y = y1; y <= y2; y += lines) {
+        int h = y2 - y + 1 < (int)lines ? y2 - y + 1 : (int)lines;
+        for (int r = 0; r < h; r++) {
+            memcpy(buf + r * w, &screen[(y + r) * PANEL_W + x1], w * sizeof(uint16_t));
+        }
+        if (plainBytes) *plainBytes += w * h * sizeof(uint16_t) + WINDOW_BYTES;
+        if (scannedBytes && filter.isScanning()) *scannedBytes += w * h * sizeof(uint16_t);
+        filter.flush(x1, y, x2, y + h - 1, buf, mockPush);
+    }
+}
+
+static bool panelMatches(int x1, int y1, int x2, int y2) {
+    for (int y = y1; y <= y2; y++) {
+        if (memcmp(&panel[y * PANEL_W + x1], &screen[y * PANEL_W + x1], (x2 - x1 + 1) * sizeof(uint16_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void resetPanel() {
+    memset(panel, 0xAA, sizeof(panel));
+    busBytes = 0;
+    busWindows = 0;
+}
+
+static uint32_t areaPx(const flush_area_t& a) {
+    return (uint32_t)(a.x2 - a.x1 + 1) * (a.y2 - a.y1 + 1);
+}
+
+static bool contains(const flush_area_t& outer, const flush_area_t& a) {
+    return a.x1 >= outer.x1 && a.y1 >= outer.y1 && a.x2 <= outer.x2 && a.y2 <= outer.y2;
+}
+
+// Invalid areas as LVGL leaves them for a frame: widgets that changed,
+// clipped to the screen, minus those _lv_inv_area() already joined
+static int randomAreas(flush_area_t* areas, int maxCount) {
+    int count = 1 + rand() % maxCount;
+    for (int i = 0; i < count; i++) {
+        int w = 4 + rand() % 120;
+        int h = 4 + rand() % 60;
+        int x = rand() % (PANEL_W - w);
+        int y = rand() % (PANEL_H - h);
+        areas[i] = { (int16_t)x, (int16_t)y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+    }
+    return count;
+}
+
+// Checks one merge result against the originals: every dirty pixel is
+// still drawn, the last slot stays live, and no drawn area exceeds the
+// budget over the dirty pixels actually inside it
+static void checkMerge(const flush_area_t* orig, const flush_area_t* areas, const uint8_t* joined,
+                       int count, uint32_t budgetPct, uint32_t dirtyPx, uint32_t overdrawPx) {
+    static uint8_t dirtyMap[PANEL_H * PANEL_W];
+    memset(dirtyMap, 0, sizeof(dirtyMap));
+    uint32_t dirty = 0;
+    for (int i = 0; i < count; i++) {
+        for (int y = orig[i].y1; y <= orig[i].y2; y++) {
+            memset(&dirtyMap[y * PANEL_W + orig[i].x1], 1, orig[i].x2 - orig[i].x1 + 1);
+        }
+        dirty += areaPx(orig[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(dirty, dirtyPx);
+    TEST_ASSERT_EQUAL_UINT8(0, joined[count - 1]);
+
+    uint32_t drawn = 0;
+    for (int i = 0; i < count; i++) {
+        bool inside = false;
+        for (int j = 0; j < count && !inside; j++) {
+            inside = !joined[j] && contains(areas[j], orig[i]);
+        }
+        TEST_ASSERT_TRUE(inside);
+        if (joined[i]) continue;
+
+        uint32_t dirtyInside = 0;
+        for (int y = areas[i].y1; y <= areas[i].y2; y++) {
+            for (int x = areas[i].x1; x <= areas[i].x2; x++) {
+                dirtyInside += dirtyMap[y * PANEL_W + x];
+            }
+        }
+        TEST_ASSERT_TRUE((uint64_t)areaPx(areas[i]) * 100 <= (uint64_t)dirtyInside * (100 + budgetPct));
+        drawn += areaPx(areas[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(drawn > dirty ? drawn - dirty : 0, overdrawPx);
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_buffer_lines_from_config(void) {
+    // Default vdbBufferSizeKB = 30 on a fresh heap: two 24-line buffers
+    int buffers = 2;
+    TEST_ASSERT_EQUAL_UINT32(24, flush_buffer_lines(30, LINE_BYTES, PANEL_H, 150000, 110000, &buffers));
+    TEST_ASSERT_EQUAL_INT(2, buffers);
+
+    // Without DMA the same budget is one 48-line buffer
+    buffers = 1;
+    TEST_ASSERT_EQUAL_UINT32(48, flush_buffer_lines(30, LINE_BYTES, PANEL_H, 150000, 110000, &buffers));
+    TEST_ASSERT_EQUAL_INT(1, buffers);
+
+    // Capped at the panel height
+    buffers = 1;
+    TEST_ASSERT_EQUAL_UINT32(PANEL_H, flush_buffer_lines(200, LINE_BYTES, PANEL_H, 400000, 300000, &buffers));
+}
+
+void test_buffer_lines_bounded_by_heap(void) {
+    // 20 KB over the reserve: two buffers of 16 lines, not 24
+    int buffers = 2;
+    uint32_t freeBytes = VDB_HEAP_RESERVE + 20 * 1024;
+    TEST_ASSERT_EQUAL_UINT32(16, flush_buffer_lines(30, LINE_BYTES, PANEL_H, freeBytes, 100000, &buffers));
+    TEST_ASSERT_EQUAL_INT(2, buffers);
+
+    // Fragmented heap: the largest block bounds each buffer
+    buffers = 2;
+    TEST_ASSERT_EQUAL_UINT32(12, flush_buffer_lines(30, LINE_BYTES, PANEL_H, 150000, 12 * LINE_BYTES + 100, &buffers));
+    TEST_ASSERT_EQUAL_INT(2, buffers);
+
+    // Two buffers would be under VDB_MIN_LINES each: one buffer instead
+    buffers = 2;
+    freeBytes = VDB_HEAP_RESERVE + 14 * LINE_BYTES;
+    TEST_ASSERT_EQUAL_UINT32(14, flush_buffer_lines(30, LINE_BYTES, PANEL_H, freeBytes, 100000, &buffers));
+    TEST_ASSERT_EQUAL_INT(1, buffers);
+
+    // Nothing left: still VDB_MIN_LINES, the allocation decides
+    buffers = 2;
+    TEST_ASSERT_EQUAL_UINT32(VDB_MIN_LINES, flush_buffer_lines(30, LINE_BYTES, PANEL_H, 1000, 1000, &buffers));
+    TEST_ASSERT_EQUAL_INT(1, buffers);
+}
+
+void test_completion_waits_only_when_asked(void) {
+    FlushTracker tracker(&mockBus);
+    flush_job_t done;
+    int disp = 0;
+    resetBus();
+
+    // Nothing in flight: nothing to release, the bus is not touched
+    TEST_ASSERT_FALSE(tracker.complete(true, &done));
+    TEST_ASSERT_EQUAL_INT(0, busyCalls + waitCalls + endCalls);
+
+    doneNs = transferNs(PANEL_W * 24);
+    flush_job_t job = { &disp, 1234, PANEL_W * 24, 3 };
+    tracker.start(job);
+    TEST_ASSERT_TRUE(tracker.isPending());
+
+    // Poll while the transfer runs: no wait, no release
+    nowNs = doneNs / 2;
+    TEST_ASSERT_FALSE(tracker.complete(false, &done));
+    TEST_ASSERT_EQUAL_INT(0, waitCalls);
+    TEST_ASSERT_EQUAL_INT(0, endCalls);
+    TEST_ASSERT_TRUE(tracker.isPending());
+
+    // wait_cb blocks until the end of the transfer, then releases
+    TEST_ASSERT_TRUE(tracker.complete(true, &done));
+    TEST_ASSERT_TRUE(nowNs == doneNs);
+    TEST_ASSERT_EQUAL_INT(1, endCalls);
+    TEST_ASSERT_FALSE(tracker.isPending());
+    TEST_ASSERT_EQUAL_PTR(&disp, done.disp);
+    TEST_ASSERT_EQUAL_UINT32(1234, done.startUs);
+    TEST_ASSERT_EQUAL_UINT32(PANEL_W * 24, done.pixels);
+    TEST_ASSERT_EQUAL_UINT16(3, done.windows);
+
+    // Released once only
+    TEST_ASSERT_FALSE(tracker.complete(true, &done));
+    TEST_ASSERT_EQUAL_INT(1, endCalls);
+
+    // A poll after the transfer ended releases without blocking
+    tracker.start(job);
+    doneNs = nowNs + 1000;
+    nowNs += 5000;
+    TEST_ASSERT_TRUE(tracker.complete(false, &done));
+    TEST_ASSERT_EQUAL_INT(2, endCalls);
+}
+
+void test_fps_one_vs_two_buffers(void) {
+    // ns per pixel for LVGL to render a stripe, against 800 ns per pixel
+    // on the bus at 20 MHz: a light screen, one as slow as the bus, and
+    // one heavier than it
+    static const uint32_t renderCosts[] = {100, 800, 1200};
+    char msg[128];
+
+    for (uint32_t cost : renderCosts) {
+        int overlaps1 = 0;
+        int overlaps2 = 0;
+        int overlapsSame = 0;
+        // Same 30 KB either way: one 48-line buffer or two of 24
+        double fps1 = runPipeline(1, 48, cost, &overlaps1);
+        double fps2 = runPipeline(2, 24, cost, &overlaps2);
+        // One 24-line buffer, as DMA without the second allocation
+        double fps1small = runPipeline(1, 24, cost, &overlapsSame);
+
+        snprintf(msg, sizeof(msg), "%3u ns/px: 1 x 48 lines %.1f fps, 1 x 24 lines %.1f fps, 2 x 24 lines %.1f fps",
+                 (unsigned)cost, fps1, fps1small, fps2);
+        TEST_MESSAGE(msg);
+
+        TEST_ASSERT_EQUAL_INT(0, overlaps1);
+        TEST_ASSERT_EQUAL_INT(0, overlaps2);
+        TEST_ASSERT_EQUAL_INT(0, overlapsSame);
+
+        // Rendering and transfer overlap: the slower of the two sets the
+        // pace, never their sum
+        double busNs = (double)transferNs(PANEL_W * 24) * (PANEL_H / 24);
+        double renderNs = (double)PANEL_W * PANEL_H * cost;
+        double bound = 1e9 / (busNs > renderNs ? busNs : renderNs);
+        TEST_ASSERT_TRUE(fps2 <= bound * 1.001);
+        TEST_ASSERT_TRUE(fps2 > bound * 0.9);
+        TEST_ASSERT_TRUE(fps2 > fps1);
+    }
+}
+
+void test_unchanged_rows_not_resent(void) {
+    static flush_row_t rows[PANEL_H];
+    FlushFilter filter(rows, PANEL_H);
+    resetPanel();
+
+    drawChat(0, 60);
+    flushArea(filter, 0, 0, PANEL_W - 1, PANEL_H - 1, 24, nullptr, nullptr);
+    TEST_ASSERT_TRUE(panelMatches(0, 0, PANEL_W - 1, PANEL_H - 1));
+    TEST_ASSERT_EQUAL_UINT32(PANEL_W * PANEL_H * 2 + 10 * WINDOW_BYTES, busBytes);
+
+    // The same frame again: nothing crosses the bus
+    busBytes = 0;
+    busWindows = 0;
+    flushArea(filter, 0, 0, PANEL_W - 1, PANEL_H - 1, 24, nullptr, nullptr);
+    TEST_ASSERT_EQUAL_UINT32(0, busBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, busWindows);
+
+    // A different span over the same rows is sent: the row hashes only
+    // cover the span they were taken over
+    flushArea(filter, 52, 8, 307, 31, 24, nullptr, nullptr);
+    TEST_ASSERT_EQUAL_UINT32(256 * 24 * 2 + WINDOW_BYTES, busBytes);
+
+    // invalidate() forgets the panel contents
+    busBytes = 0;
+    filter.invalidate();
+    flushArea(filter, 52, 8, 307, 31, 24, nullptr, nullptr);
+    TEST_ASSERT_EQUAL_UINT32(256 * 24 * 2 + WINDOW_BYTES, busBytes);
+}
+
+void test_small_gaps_joined(void) {
+    static flush_row_t rows[PANEL_H];
+    static uint16_t buf[100 * 10];
+    FlushFilter filter(rows, PANEL_H);
+    resetPanel();
+
+    for (int i = 0; i < 100 * 10; i++) buf[i] = i;
+    filter.flush(0, 0, 99, 9, buf, mockPush);
+    busWindows = 0;
+
+    // Rows 2 and 4 change: the 200 byte gap is resent in the same window
+    buf[2 * 100] ^= 1;
+    buf[4 * 100] ^= 1;
+    TEST_ASSERT_EQUAL_UINT32(3, filter.flush(0, 0, 99, 9, buf, mockPush));
+    TEST_ASSERT_EQUAL_UINT32(1, busWindows);
+
+    // Rows 2 and 5 change: a 400 byte gap is worth a second window
+    busWindows = 0;
+    buf[2 * 100] ^= 1;
+    buf[5 * 100] ^= 1;
+    TEST_ASSERT_EQUAL_UINT32(2, filter.flush(0, 0, 99, 9, buf, mockPush));
+    TEST_ASSERT_EQUAL_UINT32(2, busWindows);
+    TEST_ASSERT_EQUAL_MEMORY(buf + 5 * 100, &panel[5 * PANEL_W], 100 * sizeof(uint16_t));
+}
+
+void test_streaming_reply_bytes(void) {
+    // A reply streams into the last bubble a few characters at a time;
+    // LVGL invalidates the whole bubble on each label change
+    static flush_row_t rows[PANEL_H];
+    FlushFilter filter(rows, PANEL_H);
+    resetPanel();
+    drawChat(0, 0);
+    flushArea(filter, 0, 0, PANEL_W - 1, PANEL_H - 1, 24, nullptr, nullptr);
+
+    uint32_t plain = 0;
+    uint32_t bytes = 0;
+    uint32_t windows = 0;
+    uint32_t updates = 0;
+    for (int chars = 3; chars <= 60; chars += 3) {
+        drawChat(0, chars);
+        busBytes = 0;
+        busWindows = 0;
+        flushArea(filter, 52, 168, 307, 231, 24, &plain, nullptr);
+        TEST_ASSERT_TRUE(panelMatches(0, 0, PANEL_W - 1, PANEL_H - 1));
+        bytes += busBytes;
+        windows += busWindows;
+        updates++;
+    }
+    TEST_ASSERT_TRUE(filter.isScanning());
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "streaming reply, %u updates: %u bytes in %u windows, %u bytes unfiltered in %u",
+             (unsigned)updates, (unsigned)bytes, (unsigned)windows, (unsigned)plain, (unsigned)(updates * 3));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(bytes * 2 < plain);
+}
+
+// An image panned across the screen: no row repeats between frames
+static void drawImage(int pan) {
+    for (int y = 0; y < PANEL_H; y++) {
+        for (int x = 0; x < PANEL_W; x++) {
+            unsigned h = ((x + pan) * 73 + y * 151) * 2654435761u;
+            screen[y * PANEL_W + x] = (uint16_t)(h >> 16);
+        }
+    }
+}
+
+void test_scrolling_chat_bytes(void) {
+    static flush_row_t rows[PANEL_H];
+    FlushFilter filter(rows, PANEL_H);
+    resetPanel();
+    drawChat(0, 60);
+    flushArea(filter, 0, 0, PANEL_W - 1, PANEL_H - 1, 24, nullptr, nullptr);
+    busBytes = 0;
+    busWindows = 0;
+
+    // The list scrolls 2 px per frame; only the black rows between
+    // bubbles repeat
+    uint32_t plain = 0;
+    for (int scroll = 2; scroll <= 80; scroll += 2) {
+        drawChat(scroll, 60);
+        flushArea(filter, 40, 0, PANEL_W - 1, PANEL_H - 1, 24, &plain, nullptr);
+        TEST_ASSERT_TRUE(panelMatches(0, 0, PANEL_W - 1, PANEL_H - 1));
+    }
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "scrolling chat, 40 frames: %u bytes in %u windows, %u bytes unfiltered in 400",
+             (unsigned)busBytes, (unsigned)busWindows, (unsigned)plain);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(busBytes < plain);
+}
+
+void test_panning_image_backs_off(void) {
+    // Every row changes: scanning only costs, so after one losing window
+    // it stops for FLUSH_SCAN_BACKOFF flushes, then tries again
+    static flush_row_t rows[PANEL_H];
+    FlushFilter filter(rows, PANEL_H);
+    resetPanel();
+
+    uint32_t plain = 0;
+    uint32_t scanned = 0;
+    int firstUnscanned = -1;
+    int rescans = 0;
+    bool wasScanning = true;
+    for (int frame = 0; frame < 120; frame++) {
+        drawImage(frame);
+        flushArea(filter, 0, 0, PANEL_W - 1, PANEL_H - 1, 24, &plain, &scanned);
+        TEST_ASSERT_TRUE(panelMatches(0, 0, PANEL_W - 1, PANEL_H - 1));
+        if (firstUnscanned < 0 && !filter.isScanning()) firstUnscanned = frame;
+        if (!wasScanning && filter.isScanning()) rescans++;
+        wasScanning = filter.isScanning();
+    }
+    TEST_ASSERT_EQUAL_UINT32(plain, busBytes);
+    // Ten stripes per frame: the first window of 64 flushes ends in frame 6
+    TEST_ASSERT_EQUAL_INT(6, firstUnscanned);
+    TEST_ASSERT_GREATER_THAN(0, rescans);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "panning image, 120 frames: %u of %u bytes hashed, scan cost %.2f%% of bus time",
+             (unsigned)scanned, (unsigned)plain, 100.0 * scanned / FLUSH_SCAN_COST_DIV / plain);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(scanned / FLUSH_SCAN_COST_DIV * 100 < plain);
+}
+
+void test_merge_exact_unions_at_zero_budget(void) {
+    flush_area_t areas[4] = {
+        {0, 0, 99, 23},         // two stacked stripes of one widget
+        {0, 24, 99, 47},
+        {200, 100, 239, 139},   // a label inside its button
+        {190, 90, 249, 149},
+    };
+    uint8_t joined[4] = {0, 0, 0, 0};
+    uint32_t dirty = 0;
+    uint32_t overdraw = 0;
+    TEST_ASSERT_EQUAL_UINT16(2, flush_merge_areas(areas, joined, 4, 0, &dirty, &overdraw));
+    TEST_ASSERT_EQUAL_UINT8(1, joined[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, joined[2]);
+    TEST_ASSERT_EQUAL_INT16(0, areas[1].y1);
+    TEST_ASSERT_EQUAL_INT16(47, areas[1].y2);
+    TEST_ASSERT_EQUAL_INT16(190, areas[3].x1);
+    TEST_ASSERT_EQUAL_UINT32(0, overdraw);
+
+    // Far apart: no merge even with a generous budget
+    flush_area_t apart[2] = { {0, 0, 9, 9}, {300, 200, 309, 209} };
+    uint8_t apartJoined[2] = {0, 0};
+    TEST_ASSERT_EQUAL_UINT16(0, flush_merge_areas(apart, apartJoined, 2, 100, &dirty, &overdraw));
+
+    // Areas LVGL already joined are left alone
+    flush_area_t some[3] = { {0, 0, 99, 23}, {0, 0, 99, 23}, {0, 24, 99, 47} };
+    uint8_t someJoined[3] = {1, 0, 0};
+    TEST_ASSERT_EQUAL_UINT16(1, flush_merge_areas(some, someJoined, 3, 0, &dirty, &overdraw));
+    TEST_ASSERT_EQUAL_UINT32(100 * 48, dirty);
+    TEST_ASSERT_EQUAL_UINT8(1, someJoined[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, someJoined[2]);
+}
+
+void test_merge_keeps_coverage_and_budget(void) {
+    static const uint32_t budgets[] = {0, 10, 25, 50, 100};
+    flush_area_t orig[FLUSH_MAX_AREAS];
+    flush_area_t areas[FLUSH_MAX_AREAS];
+    uint8_t joined[FLUSH_MAX_AREAS];
+    char msg[128];
+
+    for (uint32_t budget : budgets) {
+        // The same frames for every budget
+        srand(11);
+        uint32_t frames = 0;
+        uint32_t areasIn = 0;
+        uint32_t areasOut = 0;
+        uint64_t dirtyTotal = 0;
+        uint64_t overdrawTotal = 0;
+        for (int f = 0; f < 300; f++) {
+            int count = randomAreas(orig, f % 2 ? 8 : FLUSH_MAX_AREAS);
+            memcpy(areas, orig, sizeof(flush_area_t) * count);
+            memset(joined, 0, sizeof(joined));
+            uint32_t dirty = 0;
+            uint32_t overdraw = 0;
+            uint16_t merges = flush_merge_areas(areas, joined, count, budget, &dirty, &overdraw);
+            checkMerge(orig, areas, joined, count, budget, dirty, overdraw);
+
+            frames++;
+            areasIn += count;
+            areasOut += count - merges;
+            dirtyTotal += dirty;
+            overdrawTotal += overdraw;
+        }
+        // Windows and bus bytes per frame, one window per area
+        uint64_t bytes = (dirtyTotal + overdrawTotal) * 2 + (uint64_t)areasOut * WINDOW_BYTES;
+        snprintf(msg, sizeof(msg), "budget %3u%%: %.1f -> %.1f areas/frame, overdraw %.1f%%, %.0f bytes/frame",
+                 (unsigned)budget, (double)areasIn / frames, (double)areasOut / frames,
+                 100.0 * overdrawTotal / dirtyTotal, (double)bytes / frames);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_buffer_lines_from_config);
+    RUN_TEST(test_buffer_lines_bounded_by_heap);
+    RUN_TEST(test_merge_exact_unions_at_zero_budget);
+    RUN_TEST(test_merge_keeps_coverage_and_budget);
+    RUN_TEST(test_unchanged_rows_not_resent);
+    RUN_TEST(test_small_gaps_joined);
+    RUN_TEST(test_streaming_reply_bytes);
+    RUN_TEST(test_scrolling_chat_bytes);
+    RUN_TEST(test_panning_image_backs_off);
+    RUN_TEST(test_completion_waits_only_when_asked);
+    RUN_TEST(test_fps_one_vs_two_buffers);
+    return UNITY_END();
+}
@@ -0,0 +1,256 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <list>
+#include <vector>
+#include "GlyphCache.h"
+
+#define GLYPH_BYTES     72      // 24px at 1bpp
+#define VISIBLE_MSGS    4       // chat bubbles on screen at once
+
+// A chat session as ChatApp shows it, one bubble per entry
+static const char* chat[] = {
+    "你好，今天天气怎么样？",
+    "你好！今天北京晴，气温十二到二十三度，空气质量良，适合出门散步。下午风会大一些，记得带件外套。",
+    "帮我查一下“坚持”这个词的英文怎么说，再造两个句子。",
+    "“坚持”可以翻译成 persist 或 insist on。例句一：他每天坚持跑步，已经三年了。He has persisted in running every day for three years. 例句二：她坚持自己的意见。She insisted on her opinion.",
+    "这两个词有什么区别？",
+    "persist 强调在困难面前继续做下去，常和 in 连用；insist 强调坚决要求或主张某件事，常和 on 连用。简单地说，坚持做事用 persist，坚持观点用 insist。",
+    "明白了。再给我推荐三个学习英语的好方法。",
+    "一、每天固定时间背单词，用单词卡复习，效果比一次背很多要好。二、多听多读，比如每天听十分钟英文新闻或播客。三、找机会开口说，哪怕是自言自语，也能提高口语的流利程度。",
+    "单词卡是怎么复习的？",
+    "单词卡的正面写英文单词，背面写中文意思和例句。先看正面回想意思，再翻过来检查。记住的放到一边，过几天再复习；没记住的当天多看几遍。这就是间隔重复的基本做法。",
+    "谢谢，我去试试。",
+    "不客气，祝你学习顺利！有问题随时问我。",
+};
+static const int chatCount = sizeof(chat) / sizeof(chat[0]);
+
+static uint32_t nextCodepoint(const char** p) {
+    const uint8_t* s = (const uint8_t*)*p;
+    uint32_t cp;
+    int len;
+    if (s[0] < 0x80) {
+        cp = s[0];
+        len = 1;
+    } else if ((s[0] & 0xE0) == 0xC0) {
+        cp = ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        len = 2;
+    } else {
+        cp = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        len = 3;
+    }
+    *p += len;
+    return cp;
+}
+
+// Glyph fetches while the chat screen fills: every new bubble redraws the
+// bubbles on screen, as LVGL does when the list scrolls
+static std::vector<uint32_t> chatTrace() {
+    std::vector<uint32_t> trace;
+    for (int shown = 1; shown <= chatCount; shown++) {
+        int first = shown > VISIBLE_MSGS ? shown - VISIBLE_MSGS : 0;
+        for (int m = first; m < shown; m++) {
+            const char* p = chat[m];
+            while (*p) {
+                uint32_t cp = nextCodepoint(&p);
+                if (cp > 0x20) trace.push_back(cp);
+            }
+        }
+    }
+    return trace;
+}
+
+// The cache XFontAdapter had before: 16 slots, linear scan, round-robin
+typedef struct {
+    uint32_t unicode[16];
+    int used;
+    int next;
+} old_cache_t;
+
+static bool oldFetch(old_cache_t* c, uint32_t unicode) {
+    for (int i = 0; i < c->used; i++) {
+        if (c->unicode[i] == unicode) return true;
+    }
+    if (c->used < 16) {
+        c->unicode[c->used++] = unicode;
+    } else {
+        c->unicode[c->next] = unicode;
+        c->next = (c->next + 1) % 16;
+    }
+    return false;
+}
+
+// Same fetch pattern as XFontAdapter::copyCachedGlyph(): copy, else insert
+static float replay(GlyphCache& cache, const std::vector<uint32_t>& trace) {
+    uint8_t glyph[GLYPH_BYTES];
+    for (uint32_t cp : trace) {
+        if (!cache.copy(cp, glyph)) {
+            memset(glyph, cp & 0xFF, sizeof(glyph));
+            cache.insert(cp, glyph);
+        }
+    }
+    const xfont_cache_stats_t& s = cache.getStats();
+    return 100.0f * s.hits / (s.hits + s.misses);
+}
+
+static void fillGlyph(uint8_t* glyph, uint32_t unicode) {
+    for (int i = 0; i < GLYPH_BYTES; i++) {
+        glyph[i] = (uint8_t)(unicode * 31 + i);
+    }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_capacity_within_budget(void) {
+    TEST_ASSERT_EQUAL_INT(128, GlyphCache::capacityFor(128, 72));
+    TEST_ASSERT_EQUAL_INT(XFONT_CACHE_MIN, GlyphCache::capacityFor(4, 72));
+    TEST_ASSERT_EQUAL_INT(XFONT_CACHE_MAX, GlyphCache::capacityFor(4000, 72));
+    // Deeper glyphs get fewer slots for the same RAM
+    TEST_ASSERT_EQUAL_INT(256, GlyphCache::capacityFor(512, 144));
+    TEST_ASSERT_EQUAL_INT(128, GlyphCache::capacityFor(512, 288));
+    for (int bytes : {72, 144, 288}) {
+        int slots = GlyphCache::capacityFor(XFONT_CACHE_MAX, bytes);
+        TEST_ASSERT_LESS_OR_EQUAL(XFONT_CACHE_MAX_BYTES, slots * ((bytes + 3) & ~3));
+    }
+
+    GlyphCache cache;
+    TEST_ASSERT_TRUE(cache.allocate(100, 72));
+    TEST_ASSERT_EQUAL_INT(100, cache.getCapacity());
+    TEST_ASSERT_EQUAL_INT(100, cache.getStats().capacity);
+    TEST_ASSERT_EQUAL_INT(72, cache.getSlotSize());
+    cache.release();
+    TEST_ASSERT_EQUAL_INT(0, cache.getCapacity());
+    TEST_ASSERT_EQUAL(0, cache.getMemoryUsage());
+}
+
+void test_copy_returns_inserted_glyph(void) {
+    GlyphCache cache;
+    TEST_ASSERT_TRUE(cache.allocate(16, GLYPH_BYTES));
+
+    uint8_t glyph[GLYPH_BYTES];
+    uint8_t out[GLYPH_BYTES];
+    TEST_ASSERT_FALSE(cache.copy(0x4E2D, out));
+    fillGlyph(glyph, 0x4E2D);
+    cache.insert(0x4E2D, glyph);
+    TEST_ASSERT_TRUE(cache.copy(0x4E2D, out));
+    TEST_ASSERT_EQUAL_MEMORY(glyph, out, GLYPH_BYTES);
+
+    // A second insert of the same glyph keeps the first copy
+    memset(glyph, 0xFF, sizeof(glyph));
+    cache.insert(0x4E2D, glyph);
+    TEST_ASSERT_TRUE(cache.copy(0x4E2D, out));
+    fillGlyph(glyph, 0x4E2D);
+    TEST_ASSERT_EQUAL_MEMORY(glyph, out, GLYPH_BYTES);
+
+    const xfont_cache_stats_t& s = cache.getStats();
+    TEST_ASSERT_EQUAL_UINT32(2, s.hits);
+    TEST_ASSERT_EQUAL_UINT32(1, s.misses);
+    TEST_ASSERT_EQUAL_UINT16(1, s.used);
+
+    // contains() does not count
+    TEST_ASSERT_TRUE(cache.contains(0x4E2D));
+    TEST_ASSERT_FALSE(cache.contains(0x6587));
+    TEST_ASSERT_EQUAL_UINT32(2, s.hits);
+    cache.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, s.hits);
+    TEST_ASSERT_EQUAL_UINT16(1, s.used);
+}
+
+void test_evicts_least_recently_used(void) {
+    GlyphCache cache;
+    TEST_ASSERT_TRUE(cache.allocate(16, GLYPH_BYTES));
+    uint8_t glyph[GLYPH_BYTES];
+    for (uint32_t cp = 0x4E00; cp < 0x4E10; cp++) {
+        fillGlyph(glyph, cp);
+        cache.insert(cp, glyph);
+    }
+    // The oldest glyph was used again, so the second oldest goes
+    TEST_ASSERT_TRUE(cache.contains(0x4E00));
+    fillGlyph(glyph, 0x4E10);
+    cache.insert(0x4E10, glyph);
+    TEST_ASSERT_TRUE(cache.contains(0x4E00));
+    TEST_ASSERT_FALSE(cache.contains(0x4E01));
+    TEST_ASSERT_TRUE(cache.contains(0x4E02));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getStats().evictions);
+    TEST_ASSERT_EQUAL_UINT16(16, cache.getStats().used);
+}
+
+void test_matches_reference_lru(void) {
+    // Codepoints spread over a range several times the capacity, so the
+    // hash table sees long probe chains and many backward-shift deletes
+    GlyphCache cache;
+    TEST_ASSERT_TRUE(cache.allocate(16, GLYPH_BYTES));
+    std::list<uint32_t> lru;
+    uint8_t glyph[GLYPH_BYTES];
+    uint8_t out[GLYPH_BYTES];
+    srand(99);
+
+    for (int step = 0; step < 100000; step++) {
+        uint32_t cp = 0x4E00 + (rand() % 64) * (1 + rand() % 3);
+        bool expectHit = false;
+        for (auto it = lru.begin(); it != lru.end(); ++it) {
+            if (*it == cp) {
+                lru.erase(it);
+                expectHit = true;
+                break;
+            }
+        }
+        bool hit = cache.copy(cp, out);
+        TEST_ASSERT_EQUAL(expectHit, hit);
+        if (hit) {
+            fillGlyph(glyph, cp);
+            TEST_ASSERT_EQUAL_MEMORY(glyph, out, GLYPH_BYTES);
+        } else {
+            fillGlyph(glyph, cp);
+            cache.insert(cp, glyph);
+            if (lru.size() == 16) lru.pop_back();
+        }
+        lru.push_front(cp);
+    }
+}
+
+void test_chat_trace_replay(void) {
+    std::vector<uint32_t> trace = chatTrace();
+
+    old_cache_t old = {};
+    int oldHits = 0;
+    for (uint32_t cp : trace) {
+        if (oldFetch(&old, cp)) oldHits++;
+    }
+    float oldRate = 100.0f * oldHits / trace.size();
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%d fetches: 16 round-robin %.1f%% hits", (int)trace.size(), oldRate);
+    TEST_MESSAGE(msg);
+
+    float lru128 = 0;
+    float unbounded = 0;
+    for (int capacity : {16, 64, 128, 256, 512}) {
+        GlyphCache cache;
+        TEST_ASSERT_TRUE(cache.allocate(capacity, GLYPH_BYTES));
+        float rate = replay(cache, trace);
+        snprintf(msg, sizeof(msg), "LRU %3d: %.1f%% hits, %u evictions", capacity, rate,
+                 (unsigned)cache.getStats().evictions);
+        TEST_MESSAGE(msg);
+        if (capacity == 128) lru128 = rate;
+        if (capacity == 512) unbounded = rate;
+    }
+    // The default size holds the screen; only first sightings miss
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, unbounded, lru128);
+    TEST_ASSERT_TRUE(lru128 > oldRate * 2);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_capacity_within_budget);
+    RUN_TEST(test_copy_returns_inserted_glyph);
+    RUN_TEST(test_evicts_least_recently_used);
+    RUN_TEST(test_matches_reference_lru);
+    RUN_TEST(test_chat_trace_replay);
+    return UNITY_END();
+}
@@ -0,0 +1,120 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "GlyphCache.h"
+
+#define FONT_SIZE       24
+#define GLYPHS          512
+#define ROUNDS          20
+
+static const int depths[] = {1, 2};    // XFB_MAX_BPP
+
+// Opacity per pixel value, as LVGL 8.3 lv_draw_sw_letter.c maps them
+static const uint8_t opa2[4] = {0, 85, 170, 255};
+
+static int glyphBytes(int bpp) {
+    return (FONT_SIZE * FONT_SIZE * bpp + 7) / 8;
+}
+
+// Pixel values for a CJK-like glyph: solid strokes with soft edges at
+// deeper depths, roughly what xfont_convert.py --ttf produces
+static void makeGlyph(uint8_t* out, int bpp, unsigned seed) {
+    int maxLevel = (1 << bpp) - 1;
+    memset(out, 0, glyphBytes(bpp));
+    srand(seed);
+    int bit = 0;
+    for (int y = 0; y < FONT_SIZE; y++) {
+        for (int x = 0; x < FONT_SIZE; x++) {
+            int level = 0;
+            int r = rand() % 100;
+            if (r < 30) level = maxLevel;
+            else if (r < 45) level = 1 + rand() % maxLevel;
+            if (level) {
+                out[bit >> 3] |= level << (8 - bpp - (bit & 7));
+            }
+            bit += bpp;
+        }
+    }
+}
+
+static inline uint16_t mix565(uint16_t fg, uint16_t bg, uint8_t opa) {
+    if (opa >= 255) return fg;
+    uint32_t r = (((fg >> 11) & 0x1F) * opa + ((bg >> 11) & 0x1F) * (255 - opa)) / 255;
+    uint32_t g = (((fg >> 5) & 0x3F) * opa + ((bg >> 5) & 0x3F) * (255 - opa)) / 255;
+    uint32_t b = ((fg & 0x1F) * opa + (bg & 0x1F) * (255 - opa)) / 255;
+    return (r << 11) | (g << 5) | b;
+}
+
+// The per-pixel work of LVGL's letter drawing: unpack the value, look up
+// its opacity, blend the text colour into the RGB565 draw buffer
+static void drawGlyph(const uint8_t* src, int bpp, uint16_t* dest, int stride, uint16_t color) {
+    int mask = (1 << bpp) - 1;
+    int bit = 0;
+    for (int y = 0; y < FONT_SIZE; y++) {
+        uint16_t* row = dest + y * stride;
+        for (int x = 0; x < FONT_SIZE; x++) {
+            int v = (src[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+            bit += bpp;
+            if (!v) continue;
+            uint8_t opa = bpp == 1 ? 255 : opa2[v];
+            row[x] = mix565(color, row[x], opa);
+        }
+    }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_cache_budget_per_depth(void) {
+    char msg[96];
+    for (int bpp : depths) {
+        GlyphCache cache;
+        TEST_ASSERT_TRUE(cache.allocate(XFONT_CACHE_MAX, glyphBytes(bpp)));
+        int bitmapBytes = cache.getCapacity() * cache.getSlotSize();
+        TEST_ASSERT_LESS_OR_EQUAL(XFONT_CACHE_MAX_BYTES, bitmapBytes);
+        snprintf(msg, sizeof(msg), "%dbpp: %d B/glyph, %d slots, %u B total", bpp, glyphBytes(bpp),
+                 cache.getCapacity(), (unsigned)cache.getMemoryUsage());
+        TEST_MESSAGE(msg);
+    }
+}
+
+void test_render_cost_per_depth(void) {
+    static uint16_t buf[FONT_SIZE * 320];
+    char msg[96];
+    double cost1 = 0;
+    for (int bpp : depths) {
+        int bytes = glyphBytes(bpp);
+        uint8_t* glyphs = (uint8_t*)malloc(GLYPHS * bytes);
+        for (int i = 0; i < GLYPHS; i++) {
+            makeGlyph(glyphs + i * bytes, bpp, i);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < GLYPHS; i++) {
+                // A line of text across a 320 px wide stripe
+                int x = (i % 13) * FONT_SIZE;
+                drawGlyph(glyphs + i * bytes, bpp, buf + x, 320, 0xFFFF);
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        free(glyphs);
+
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (ROUNDS * GLYPHS);
+        if (bpp == 1) cost1 = ns;
+        snprintf(msg, sizeof(msg), "%dbpp: %.0f ns/glyph (%.1fx 1bpp) [%u]", bpp, ns, ns / cost1, buf[bpp] & 1);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cache_budget_per_depth);
+    RUN_TEST(test_render_cost_per_depth);
+    return UNITY_END();
+}
@@ -0,0 +1,163 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "GlyphCache.h"
+
+#define GLYPH_BYTES     72
+#define GLYPH_COUNT     2000    // distinct codepoints, far more than the cache holds
+#define FETCHERS        6
+#define FETCHES         40000   // per fetcher
+
+// Stand-ins for XFontAdapter's two locks: cacheMux (spinlock, RAM work
+// only) and ioLock (held for font file access and the idle close)
+static std::mutex cacheMux;
+static std::mutex ioLock;
+static GlyphCache cache;
+static bool fileOpen;
+static std::atomic<uint32_t> fileOpens;
+static std::atomic<bool> stop;
+
+static uint32_t codepoint(int i) {
+    return 0x4E00 + i * 7;
+}
+
+// What the font file holds for a codepoint
+static void expectedGlyph(uint32_t unicode, uint8_t* out) {
+    for (int i = 0; i < GLYPH_BYTES; i++) {
+        out[i] = (uint8_t)(unicode * 131 + i * 7);
+    }
+}
+
+// XFontAdapter::loadGlyph(): read under ioLock, reopening the file if
+// update() closed it, and decode outside the lock
+static void loadGlyph(uint32_t unicode, uint8_t* out) {
+    uint8_t raw[GLYPH_BYTES];
+    {
+        std::lock_guard<std::mutex> io(ioLock);
+        if (!fileOpen) {
+            fileOpen = true;
+            fileOpens++;
+        }
+        expectedGlyph(unicode, raw);
+    }
+    memcpy(out, raw, GLYPH_BYTES);
+}
+
+// XFontAdapter::copyCachedGlyph(): copy under the cache lock, or load and
+// insert. Each caller has its own output buffer.
+static void fetchGlyph(uint32_t unicode, uint8_t* out) {
+    bool hit;
+    {
+        std::lock_guard<std::mutex> lock(cacheMux);
+        hit = cache.copy(unicode, out);
+    }
+    if (hit) return;
+
+    loadGlyph(unicode, out);
+    std::lock_guard<std::mutex> lock(cacheMux);
+    cache.insert(unicode, out);
+}
+
+static void fetcher(int id, std::atomic<int>* bad) {
+    std::mt19937 rng(id);
+    // Skewed like text: a few hot glyphs and a long tail
+    std::geometric_distribution<int> pick(0.01);
+    uint8_t out[GLYPH_BYTES];
+    uint8_t expect[GLYPH_BYTES];
+    for (int n = 0; n < FETCHES; n++) {
+        uint32_t unicode = codepoint(pick(rng) % GLYPH_COUNT);
+        memset(out, 0xEE, sizeof(out));
+        fetchGlyph(unicode, out);
+        expectedGlyph(unicode, expect);
+        if (memcmp(out, expect, GLYPH_BYTES) != 0) {
+            (*bad)++;
+        }
+    }
+}
+
+// The app task: update() closes the idle font file under ioLock, and the
+// stats are read while glyphs are fetched
+static void appTask(std::atomic<int>* statReads) {
+    while (!stop) {
+        {
+            std::lock_guard<std::mutex> io(ioLock);
+            fileOpen = false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(cacheMux);
+            const xfont_cache_stats_t& s = cache.getStats();
+            if (s.used <= s.capacity) (*statReads)++;
+        }
+        std::this_thread::yield();
+    }
+}
+
+static void runStress(int capacity) {
+    TEST_ASSERT_TRUE(cache.allocate(capacity, GLYPH_BYTES));
+    fileOpen = false;
+    fileOpens = 0;
+    stop = false;
+
+    std::atomic<int> bad(0);
+    std::atomic<int> statReads(0);
+    std::thread app(appTask, &statReads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < FETCHERS; i++) {
+        threads.emplace_back(fetcher, i + 1, &bad);
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    stop = true;
+    app.join();
+
+    const xfont_cache_stats_t& s = cache.getStats();
+    char msg[128];
+    snprintf(msg, sizeof(msg), "capacity %d: %u hits, %u misses, %u evictions, %u file opens",
+             capacity, (unsigned)s.hits, (unsigned)s.misses, (unsigned)s.evictions, (unsigned)fileOpens);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_INT(0, bad.load());
+    TEST_ASSERT_EQUAL_UINT32(FETCHERS * FETCHES, s.hits + s.misses);
+    TEST_ASSERT_LESS_OR_EQUAL(capacity, s.used);
+    TEST_ASSERT_GREATER_THAN(0, statReads.load());
+
+    // Every glyph still cached reads back intact
+    uint8_t out[GLYPH_BYTES];
+    uint8_t expect[GLYPH_BYTES];
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        if (cache.contains(codepoint(i))) {
+            cache.copy(codepoint(i), out);
+            expectedGlyph(codepoint(i), expect);
+            TEST_ASSERT_EQUAL_MEMORY(expect, out, GLYPH_BYTES);
+        }
+    }
+    cache.release();
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_minimum_cache_under_contention(void) {
+    // Nearly every fetch evicts, so inserts race with copies constantly
+    runStress(XFONT_CACHE_MIN);
+}
+
+void test_default_cache_under_contention(void) {
+    runStress(XFONT_CACHE_DEFAULT);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_minimum_cache_under_contention);
+    RUN_TEST(test_default_cache_under_contention);
+    return UNITY_END();
+}
@@ -0,0 +1,219 @@
+#include <unity.h>
+#include "PerfGovernor.h"
+
+// LVGL task passes are at least this far apart while the display is busy
+#define PASS_MS     5
+
+// Synthetic activity trace, turned into governor input on every pass
+typedef struct {
+    bool fingerDown;
+    uint32_t liftMs;
+    uint16_t animations;
+    uint32_t dirtyPx;
+    power_state_t power;
+} trace_t;
+
+static perf_gov_policy_t policy;
+static perf_gov_state_t gov;
+static trace_t trace;
+static uint32_t nowMs;
+static int periodChanges;
+
+static perf_gov_input_t sampleTrace() {
+    perf_gov_input_t in;
+    in.sinceInputMs = trace.fingerDown ? 0 : nowMs - trace.liftMs;
+    in.dirtyPxPerFrame = trace.dirtyPx;
+    in.animations = trace.animations;
+    in.powerState = trace.power;
+    return in;
+}
+
+// Steps the governor the way runGovernor() does, for ms of trace time
+static void run(uint32_t ms) {
+    uint32_t end = nowMs + ms;
+    while (nowMs < end) {
+        nowMs += PASS_MS;
+        uint32_t before = gov.periodMs;
+        perf_gov_step(gov, policy(sampleTrace()), nowMs);
+        if (gov.periodMs != before) {
+            periodChanges++;
+        }
+    }
+}
+
+// Runs until the period changes; returns how long that took
+static uint32_t runUntilChange(uint32_t limitMs) {
+    uint32_t start = nowMs;
+    uint32_t period = gov.periodMs;
+    while (gov.periodMs == period && nowMs - start < limitMs) {
+        run(PASS_MS);
+    }
+    return nowMs - start;
+}
+
+static void touch(uint32_t holdMs) {
+    trace.fingerDown = true;
+    run(holdMs);
+    trace.fingerDown = false;
+    trace.liftMs = nowMs;
+}
+
+static void assertGov(uint32_t periodMs, perf_gov_reason_t reason) {
+    TEST_ASSERT_EQUAL_UINT32(periodMs, gov.periodMs);
+    TEST_ASSERT_EQUAL_INT(reason, gov.reason);
+}
+
+void setUp(void) {
+    policy = perf_gov_default_policy;
+    gov.periodMs = PERF_GOV_FAST_MS;
+    gov.reason = PERF_GOV_QUIET;
+    gov.slowing = false;
+    gov.slowingSinceMs = 0;
+    nowMs = 100000;
+    trace.fingerDown = false;
+    trace.liftMs = 0;
+    trace.animations = 0;
+    trace.dirtyPx = 0;
+    trace.power = POWER_STATE_ACTIVE;
+    periodChanges = 0;
+    // Settle into the quiet cadence
+    run(PERF_GOV_HOLD_MS + PASS_MS);
+    periodChanges = 0;
+}
+
+void tearDown(void) {
+}
+
+void test_default_policy_priorities(void) {
+    perf_gov_input_t in = {0, PERF_GOV_DIRTY_PX, 3, POWER_STATE_SLEEP};
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_SLEEP, perf_gov_default_policy(in).reason);
+    in.powerState = POWER_STATE_IDLE;
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_INPUT, perf_gov_default_policy(in).reason);
+    in.sinceInputMs = PERF_GOV_INPUT_MS;
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_ANIM, perf_gov_default_policy(in).reason);
+    in.animations = 0;
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_IDLE, perf_gov_default_policy(in).reason);
+    in.powerState = POWER_STATE_ACTIVE;
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_DIRTY, perf_gov_default_policy(in).reason);
+    in.dirtyPxPerFrame = PERF_GOV_DIRTY_PX - 1;
+    TEST_ASSERT_EQUAL_INT(PERF_GOV_QUIET, perf_gov_default_policy(in).reason);
+    TEST_ASSERT_EQUAL_UINT32(PERF_GOV_QUIET_MS, perf_gov_default_policy(in).periodMs);
+}
+
+void test_quiet_start(void) {
+    assertGov(PERF_GOV_QUIET_MS, PERF_GOV_QUIET);
+}
+
+void test_drag_runs_fast_then_holds(void) {
+    touch(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_INPUT);
+
+    // Fast for the whole drag and the fling window after the lift
+    touch(800);
+    run(PERF_GOV_INPUT_MS - PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_INPUT);
+
+    // Then quiet, but only after the hold
+    uint32_t waited = runUntilChange(2000);
+    TEST_ASSERT_INT_WITHIN(PASS_MS, PERF_GOV_HOLD_MS, waited);
+    assertGov(PERF_GOV_QUIET_MS, PERF_GOV_QUIET);
+    TEST_ASSERT_EQUAL_INT(2, periodChanges);
+}
+
+void test_animation_lulls_do_not_flip(void) {
+    trace.animations = 1;
+    run(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_ANIM);
+
+    // Gaps between chained animations shorter than the hold
+    for (int i = 0; i < 10; i++) {
+        trace.animations = 0;
+        run(PERF_GOV_HOLD_MS - 50);
+        trace.animations = 1;
+        run(100);
+    }
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_ANIM);
+    TEST_ASSERT_EQUAL_INT(1, periodChanges);
+
+    trace.animations = 0;
+    TEST_ASSERT_INT_WITHIN(PASS_MS, PERF_GOV_HOLD_MS, runUntilChange(2000));
+    assertGov(PERF_GOV_QUIET_MS, PERF_GOV_QUIET);
+}
+
+void test_large_redraw_without_input(void) {
+    trace.dirtyPx = PERF_GOV_PANEL_PX / 2;
+    run(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_DIRTY);
+
+    // Small updates such as a clock label stay quiet
+    trace.dirtyPx = 60 * 20;
+    run(PERF_GOV_HOLD_MS + PASS_MS);
+    assertGov(PERF_GOV_QUIET_MS, PERF_GOV_QUIET);
+}
+
+void test_reason_change_at_same_period_applies_at_once(void) {
+    trace.animations = 2;
+    run(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_ANIM);
+    touch(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_INPUT);
+    TEST_ASSERT_EQUAL_INT(1, periodChanges);
+}
+
+void test_power_states(void) {
+    trace.power = POWER_STATE_IDLE;
+    TEST_ASSERT_INT_WITHIN(PASS_MS, PERF_GOV_HOLD_MS, runUntilChange(2000));
+    assertGov(PERF_GOV_IDLE_MS, PERF_GOV_IDLE);
+
+    trace.power = POWER_STATE_SLEEP;
+    TEST_ASSERT_INT_WITHIN(PASS_MS, PERF_GOV_HOLD_MS, runUntilChange(2000));
+    assertGov(PERF_GOV_SLEEP_MS, PERF_GOV_SLEEP);
+
+    // Waking on a touch is immediate
+    trace.power = POWER_STATE_ACTIVE;
+    touch(PASS_MS);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_INPUT);
+}
+
+void test_slow_down_restarts_after_interruption(void) {
+    trace.animations = 1;
+    run(PASS_MS);
+    trace.animations = 0;
+    run(PERF_GOV_HOLD_MS - 20);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_ANIM);
+
+    // A fast proposal cancels the pending hold; the next one starts over
+    trace.animations = 1;
+    run(PASS_MS);
+    trace.animations = 0;
+    run(PERF_GOV_HOLD_MS - 20);
+    assertGov(PERF_GOV_FAST_MS, PERF_GOV_ANIM);
+    run(40);
+    assertGov(PERF_GOV_QUIET_MS, PERF_GOV_QUIET);
+}
+
+static perf_gov_decision_t alwaysSlow(const perf_gov_input_t& in) {
+    (void)in;
+    return {100, PERF_GOV_IDLE};
+}
+
+void test_custom_policy(void) {
+    policy = alwaysSlow;
+    touch(PASS_MS);
+    run(PERF_GOV_HOLD_MS);
+    assertGov(100, PERF_GOV_IDLE);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_default_policy_priorities);
+    RUN_TEST(test_quiet_start);
+    RUN_TEST(test_drag_runs_fast_then_holds);
+    RUN_TEST(test_animation_lulls_do_not_flip);
+    RUN_TEST(test_large_redraw_without_input);
+    RUN_TEST(test_reason_change_at_same_period_applies_at_once);
+    RUN_TEST(test_power_states);
+    RUN_TEST(test_slow_down_restarts_after_interruption);
+    RUN_TEST(test_custom_policy);
+    return UNITY_END();
+}
@@ -0,0 +1,264 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ReadAhead.h"
+
+#define FILE_SIZE       (60 * 1024 + 123)   // an image or font, not block aligned
+
+// Rough cost of an SD read over SPI at 20 MHz: command and sector latency
+// per call, then about 2.5 MB/s
+#define SD_CALL_US      250
+#define SD_BYTE_NS      400
+
+// Fake FS: one file in RAM, counting the calls fs::File would have made
+static uint8_t fileData[FILE_SIZE];
+static uint32_t filePos;
+static uint32_t deviceCalls;
+static uint32_t deviceSeeks;
+static uint32_t deviceBytes;
+
+static uint32_t fakeRead(void* ctx, uint32_t pos, uint8_t* dst, uint32_t len) {
+    (void)ctx;
+    if (pos != filePos) {
+        deviceSeeks++;
+        filePos = pos;
+    }
+    uint32_t n = pos < FILE_SIZE ? FILE_SIZE - pos : 0;
+    if (n > len) n = len;
+    memcpy(dst, fileData + pos, n);
+    filePos += n;
+    deviceCalls++;
+    deviceBytes += n;
+    return n;
+}
+
+static void resetFile() {
+    for (int i = 0; i < FILE_SIZE; i++) {
+        fileData[i] = (uint8_t)(i * 31 + (i >> 8));
+    }
+    filePos = 0;
+    deviceCalls = 0;
+    deviceSeeks = 0;
+    deviceBytes = 0;
+}
+
+// One handle as fs_read_cb and fs_seek_cb drive it
+typedef struct {
+    ReadAhead block;
+    uint32_t pos;
+    uint32_t blockSize;
+    readahead_stats_t stats;
+} handle_t;
+
+static void openHandle(handle_t* h, uint32_t blockSize) {
+    h->pos = 0;
+    h->blockSize = blockSize;
+    memset(&h->stats, 0, sizeof(h->stats));
+}
+
+static uint32_t readAt(handle_t* h, uint8_t* dst, uint32_t len) {
+    uint32_t n = h->block.read(h->pos, dst, len, h->blockSize, fakeRead, NULL, &h->stats);
+    h->pos += n;
+    return n;
+}
+
+static void seekTo(handle_t* h, uint32_t pos) {
+    h->pos = pos;
+    h->block.seek(pos, &h->stats);
+}
+
+// Read and check against the file
+static void readChecked(handle_t* h, uint32_t len) {
+    static uint8_t out[FILE_SIZE + 64];
+    uint32_t pos = h->pos;
+    uint32_t expect = pos < FILE_SIZE ? FILE_SIZE - pos : 0;
+    if (expect > len) expect = len;
+    uint32_t n = readAt(h, out, len);
+    TEST_ASSERT_EQUAL_UINT32(expect, n);
+    if (n) TEST_ASSERT_EQUAL_MEMORY(fileData + pos, out, n);
+}
+
+typedef enum {
+    TRACE_SEQUENTIAL,   // a decoder walking the file in small reads
+    TRACE_BINFONT,      // lv_font_load: tables, then glyphs by offset
+    TRACE_LARGE,        // whole-chunk reads, bigger than a block
+} trace_t;
+
+static void runTrace(handle_t* h, trace_t trace) {
+    srand(5);
+    switch (trace) {
+        case TRACE_SEQUENTIAL:
+            while (h->pos < FILE_SIZE) {
+                readChecked(h, 4 + rand() % 60);
+            }
+            break;
+        case TRACE_BINFONT:
+            // Table headers: a length and a tag, then the table
+            for (int t = 0; t < 6; t++) {
+                readChecked(h, 4);
+                readChecked(h, 4);
+                readChecked(h, 200 + rand() % 800);
+            }
+            // Glyph lookups jump around the bitmap table
+            for (int g = 0; g < 400; g++) {
+                uint32_t pos = 8192 + (rand() % 3000) * 17;
+                seekTo(h, pos);
+                readChecked(h, 8);
+                readChecked(h, 40 + rand() % 60);
+            }
+            break;
+        case TRACE_LARGE:
+            while (h->pos < FILE_SIZE) {
+                readChecked(h, 20000);
+            }
+            break;
+    }
+}
+
+void setUp(void) {
+    resetFile();
+}
+
+void tearDown(void) {
+}
+
+void test_reads_match_file(void) {
+    static const uint32_t blockSizes[] = {1, 64, 4096, 16384};
+    for (uint32_t blockSize : blockSizes) {
+        handle_t h;
+        openHandle(&h, blockSize);
+        srand(blockSize);
+        for (int i = 0; i < 3000; i++) {
+            int op = rand() % 10;
+            if (op == 0) {
+                seekTo(&h, rand() % (FILE_SIZE + 100));
+            } else if (op == 1) {
+                // Just behind the position, as a decoder re-reading a header
+                seekTo(&h, h.pos > 10 ? h.pos - 10 : 0);
+            } else if (op == 2) {
+                readChecked(&h, 1 + rand() % 40000);
+            } else {
+                readChecked(&h, 1 + rand() % 100);
+            }
+        }
+        // At and past the end: nothing
+        seekTo(&h, FILE_SIZE);
+        readChecked(&h, 10);
+        seekTo(&h, FILE_SIZE + 50);
+        readChecked(&h, 10);
+        h.block.release();
+        TEST_ASSERT_FALSE(h.block.hasBuffer());
+    }
+}
+
+void test_seek_keeps_block_inside_window(void) {
+    handle_t h;
+    openHandle(&h, 4096);
+    readChecked(&h, 16);
+    TEST_ASSERT_EQUAL_UINT32(1, deviceCalls);
+    TEST_ASSERT_TRUE(h.block.hasData());
+
+    // Back to the start and forward within the block: from RAM
+    seekTo(&h, 0);
+    readChecked(&h, 16);
+    seekTo(&h, 4000);
+    readChecked(&h, 96);
+    TEST_ASSERT_EQUAL_UINT32(1, deviceCalls);
+    TEST_ASSERT_EQUAL_UINT32(0, h.stats.invalidations);
+
+    // Just past the end keeps it; the read then needs the next block
+    seekTo(&h, 4096);
+    TEST_ASSERT_TRUE(h.block.hasData());
+    readChecked(&h, 16);
+    TEST_ASSERT_EQUAL_UINT32(2, deviceCalls);
+    TEST_ASSERT_EQUAL_UINT32(0, deviceSeeks);
+
+    // Outside the window: dropped and counted
+    seekTo(&h, 100);
+    TEST_ASSERT_FALSE(h.block.hasData());
+    TEST_ASSERT_EQUAL_UINT32(1, h.stats.invalidations);
+    readChecked(&h, 16);
+    TEST_ASSERT_EQUAL_UINT32(3, deviceCalls);
+    TEST_ASSERT_EQUAL_UINT32(1, deviceSeeks);
+
+    TEST_ASSERT_EQUAL_UINT32(5, h.stats.reads);
+    TEST_ASSERT_EQUAL_UINT32(2, h.stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(3, h.stats.deviceReads);
+    TEST_ASSERT_EQUAL_UINT32(16 + 96, h.stats.bytesSaved);
+    h.block.release();
+}
+
+void test_written_drops_overlapping_block(void) {
+    handle_t h;
+    openHandle(&h, 4096);
+    seekTo(&h, 4096);
+    readChecked(&h, 16);
+    TEST_ASSERT_TRUE(h.block.hasData());
+
+    // Before and after the block: kept
+    h.block.written(0, 4096);
+    h.block.written(8192, 10);
+    TEST_ASSERT_TRUE(h.block.hasData());
+
+    // One byte into it: dropped
+    h.block.written(4000, 97);
+    TEST_ASSERT_FALSE(h.block.hasData());
+    TEST_ASSERT_TRUE(h.block.hasBuffer());
+    h.block.release();
+}
+
+void test_block_size_benchmark(void) {
+    // 1 is what readAheadKB = 0 gives: every read goes to the device
+    static const uint32_t blockSizes[] = {1, 4096, 8192, 16384};
+    static const char* names[] = {"sequential", "binfont", "large reads"};
+    char msg[160];
+
+    for (int t = 0; t < 3; t++) {
+        uint32_t plainCalls = 0;
+        double plainMs = 0;
+        for (uint32_t blockSize : blockSizes) {
+            resetFile();
+            handle_t h;
+            openHandle(&h, blockSize);
+            runTrace(&h, (trace_t)t);
+            h.block.release();
+
+            TEST_ASSERT_EQUAL_UINT32(deviceCalls, h.stats.deviceReads);
+            double ms = (deviceCalls * SD_CALL_US * 1000.0 + (double)deviceBytes * SD_BYTE_NS) / 1e6;
+            if (blockSize == 1) {
+                plainCalls = deviceCalls;
+                plainMs = ms;
+            }
+            snprintf(msg, sizeof(msg), "%-11s %5u B blocks: %4u reads, %4u device calls, %7u B, %3u%% hits, %5u B saved, ~%.0f ms",
+                     names[t], (unsigned)blockSize, (unsigned)h.stats.reads, (unsigned)deviceCalls,
+                     (unsigned)deviceBytes, (unsigned)(h.stats.hits * 100 / h.stats.reads),
+                     (unsigned)h.stats.bytesSaved, ms);
+            TEST_MESSAGE(msg);
+            // Never slower than reading straight through, even for
+            // random access
+            TEST_ASSERT_TRUE(ms <= plainMs);
+
+            if (t == TRACE_SEQUENTIAL && blockSize > 1) {
+                // One device call per block, and one that finds the end
+                // of the file when the last read runs past it
+                TEST_ASSERT_LESS_OR_EQUAL((FILE_SIZE + blockSize - 1) / blockSize + 1, deviceCalls);
+                TEST_ASSERT_EQUAL_UINT32(0, deviceSeeks);
+            }
+            if (t == TRACE_LARGE) {
+                // Reads bigger than a block bypass it: no extra calls or bytes
+                TEST_ASSERT_EQUAL_UINT32(plainCalls, deviceCalls);
+                TEST_ASSERT_EQUAL_UINT32(FILE_SIZE, deviceBytes);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_reads_match_file);
+    RUN_TEST(test_seek_keeps_block_inside_window);
+    RUN_TEST(test_written_drops_overlapping_block);
+    RUN_TEST(test_block_size_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,266 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ResourceCache.h"
+
+static uint8_t* blob(size_t size) {
+    uint8_t* p = (uint8_t*)malloc(size);
+    memset(p, 0x5A, size);
+    return p;
+}
+
+static int add(ResourceCache& cache, const char* path, size_t size) {
+    uint8_t* data = blob(size);
+    int i = cache.insert(path, ResourceCache::hashPath(path), data, size);
+    if (i < 0) free(data);
+    return i;
+}
+
+static int addWithHash(ResourceCache& cache, const char* path, uint32_t hash) {
+    uint8_t* data = blob(16);
+    int i = cache.insert(path, hash, data, 16);
+    if (i < 0) free(data);
+    return i;
+}
+
+static bool cached(ResourceCache& cache, const char* path) {
+    return cache.find(path, ResourceCache::hashPath(path)) >= 0;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_hash_is_fnv1a(void) {
+    TEST_ASSERT_EQUAL_UINT32(0x811C9DC5u, ResourceCache::hashPath(""));
+    TEST_ASSERT_EQUAL_UINT32(0xE40C292Cu, ResourceCache::hashPath("a"));
+}
+
+void test_insert_and_find(void) {
+    ResourceCache cache(4096);
+    int a = add(cache, "S:/img/a.bin", 100);
+    int b = add(cache, "S:/img/b.bin", 200);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, a);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, b);
+    TEST_ASSERT_EQUAL_INT(a, cache.lookup("S:/img/a.bin", ResourceCache::hashPath("S:/img/a.bin")));
+    TEST_ASSERT_EQUAL_INT(-1, cache.lookup("S:/img/c.bin", ResourceCache::hashPath("S:/img/c.bin")));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getHits());
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getMisses());
+    TEST_ASSERT_EQUAL(300, cache.getUsedMemory());
+}
+
+void test_victim_is_largest_stalest(void) {
+    ResourceCache cache(1000);
+    add(cache, "big", 500);
+    add(cache, "small1", 200);
+    add(cache, "small2", 200);
+    // Used since, but small
+    cache.touch(cache.find("small1", ResourceCache::hashPath("small1")));
+
+    TEST_ASSERT_GREATER_OR_EQUAL(0, add(cache, "new", 300));
+    TEST_ASSERT_FALSE(cached(cache, "big"));
+    TEST_ASSERT_TRUE(cached(cache, "small1"));
+    TEST_ASSERT_TRUE(cached(cache, "small2"));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getEvictions());
+}
+
+void test_pinned_entries_are_never_evicted(void) {
+    ResourceCache cache(1000);
+    int a = add(cache, "pinned", 600);
+    CacheHandle h;
+    cache.pin(a, &h);
+    add(cache, "other", 300);
+
+    // The pinned entry is the better victim by size x age but must stay
+    for (int i = 0; i < 20; i++) {
+        char path[24];
+        snprintf(path, sizeof(path), "churn%d", i);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, add(cache, path, 350));
+        TEST_ASSERT_TRUE(cached(cache, "pinned"));
+    }
+    TEST_ASSERT_EQUAL_PTR(h.data, cache.getEntry(a).data);
+    TEST_ASSERT_EQUAL(600, h.size);
+
+    // clear() keeps it too
+    cache.clear();
+    TEST_ASSERT_TRUE(cached(cache, "pinned"));
+    TEST_ASSERT_EQUAL(600, cache.getUsedMemory());
+
+    cache.evict(a);
+    TEST_ASSERT_TRUE(cached(cache, "pinned"));
+    cache.unpin(a);
+    cache.evict(a);
+    TEST_ASSERT_FALSE(cached(cache, "pinned"));
+    TEST_ASSERT_EQUAL(0, cache.getUsedMemory());
+}
+
+void test_removed_pinned_entry_lives_until_unpinned(void) {
+    ResourceCache cache(1000);
+    int a = add(cache, "img", 400);
+    CacheHandle h;
+    cache.pin(a, &h);
+
+    // Rewritten file: new lookups miss, the holder keeps the old bytes
+    cache.remove(a);
+    TEST_ASSERT_FALSE(cached(cache, "img"));
+    TEST_ASSERT_EQUAL_PTR(h.data, cache.getEntry(a).data);
+    TEST_ASSERT_EQUAL(400, cache.getUsedMemory());
+
+    int b = add(cache, "img", 300);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, b);
+    TEST_ASSERT_NOT_EQUAL(a, b);
+    TEST_ASSERT_EQUAL(b, cache.find("img", ResourceCache::hashPath("img")));
+
+    cache.unpin(a);
+    TEST_ASSERT_FALSE(cache.getEntry(a).valid);
+    TEST_ASSERT_EQUAL(300, cache.getUsedMemory());
+    TEST_ASSERT_EQUAL(b, cache.find("img", ResourceCache::hashPath("img")));
+
+    // Unpinned entries go at once
+    cache.remove(b);
+    TEST_ASSERT_FALSE(cached(cache, "img"));
+    TEST_ASSERT_EQUAL(0, cache.getUsedMemory());
+}
+
+void test_insert_rejected_when_rest_is_pinned(void) {
+    ResourceCache cache(1000);
+    CacheHandle h1, h2;
+    cache.pin(add(cache, "a", 600), &h1);
+    int b = add(cache, "b", 300);
+    cache.pin(b, &h2);
+
+    TEST_ASSERT_EQUAL_INT(-1, add(cache, "c", 200));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getRejects());
+    TEST_ASSERT_EQUAL_UINT32(0, cache.getEvictions());
+    TEST_ASSERT_TRUE(cached(cache, "a"));
+    TEST_ASSERT_TRUE(cached(cache, "b"));
+
+    // Fits in what is left without evicting
+    TEST_ASSERT_GREATER_OR_EQUAL(0, add(cache, "d", 100));
+
+    // Releasing one frees its room for eviction
+    cache.unpin(b);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, add(cache, "c", 200));
+    TEST_ASSERT_FALSE(cached(cache, "b"));
+
+    // Larger than the whole budget never fits
+    TEST_ASSERT_FALSE(cache.makeRoom(1001));
+}
+
+void test_insert_rejected_when_all_entries_pinned(void) {
+    ResourceCache cache(1 << 20);
+    CacheHandle h;
+    for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+        char path[24];
+        snprintf(path, sizeof(path), "p%d", i);
+        int e = add(cache, path, 8);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, e);
+        cache.pin(e, &h);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, add(cache, "extra", 8));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getRejects());
+}
+
+// Every live entry reachable from its home slot, evicted ones gone
+static void assertIndexIntact(ResourceCache& cache, const char** paths, const uint32_t* hashes,
+                              const bool* live, int count) {
+    for (int i = 0; i < count; i++) {
+        int e = cache.find(paths[i], hashes[i]);
+        if (live[i]) {
+            TEST_ASSERT_GREATER_OR_EQUAL(0, e);
+            TEST_ASSERT_EQUAL_STRING(paths[i], cache.getEntry(e).path);
+        } else {
+            TEST_ASSERT_EQUAL_INT(-1, e);
+        }
+    }
+}
+
+void test_unlink_keeps_probe_chains(void) {
+    // One run wrapping past the end of the table: homes 30, 30, 31, 0, 30, 1
+    const char* paths[] = {"h30a", "h30b", "h31", "h0", "h30c", "h1"};
+    const uint32_t hashes[] = {30, 30 + CACHE_HASH_SLOTS, 31, 0, 30 + 2 * CACHE_HASH_SLOTS, 1};
+    const int count = 6;
+    bool live[count];
+    int entries[count];
+
+    // Each eviction order starts from a fresh run
+    const int orders[][6] = {
+        {0, 1, 2, 3, 4, 5},
+        {5, 4, 3, 2, 1, 0},
+        {1, 3, 0, 5, 2, 4},
+        {2, 0, 4, 1, 5, 3},
+        {3, 2, 5, 4, 0, 1},
+    };
+    for (const int* order : orders) {
+        ResourceCache cache(1 << 20);
+        for (int i = 0; i < count; i++) {
+            entries[i] = addWithHash(cache, paths[i], hashes[i]);
+            TEST_ASSERT_GREATER_OR_EQUAL(0, entries[i]);
+            live[i] = true;
+        }
+        assertIndexIntact(cache, paths, hashes, live, count);
+        for (int k = 0; k < count; k++) {
+            cache.evict(entries[order[k]]);
+            live[order[k]] = false;
+            assertIndexIntact(cache, paths, hashes, live, count);
+        }
+    }
+}
+
+void test_random_churn_keeps_index(void) {
+    const int pathCount = 40;
+    char paths[pathCount][16];
+    const char* pathPtrs[pathCount];
+    uint32_t hashes[pathCount];
+    bool live[pathCount];
+    for (int i = 0; i < pathCount; i++) {
+        snprintf(paths[i], sizeof(paths[i]), "r%d", i);
+        pathPtrs[i] = paths[i];
+        // Only four home slots, so runs are long and overlap
+        hashes[i] = (uint32_t)(i % 4) * 9 + (uint32_t)i * CACHE_HASH_SLOTS;
+        live[i] = false;
+    }
+
+    ResourceCache cache(64 * CACHE_MAX_ENTRIES);
+    srand(42);
+    for (int step = 0; step < 5000; step++) {
+        int p = rand() % pathCount;
+        int e = cache.find(paths[p], hashes[p]);
+        if (e >= 0) {
+            cache.evict(e);
+        } else {
+            size_t size = 16 + rand() % 48;
+            e = cache.insert(paths[p], hashes[p], blob(size), size);
+            TEST_ASSERT_GREATER_OR_EQUAL(0, e);
+        }
+        // Inserts may have evicted others; recompute from the entries
+        for (int i = 0; i < pathCount; i++) {
+            live[i] = false;
+        }
+        for (int i = 0; i < CACHE_MAX_ENTRIES; i++) {
+            const CacheEntry& entry = cache.getEntry(i);
+            if (entry.valid) {
+                live[atoi(entry.path + 1)] = true;
+            }
+        }
+        assertIndexIntact(cache, pathPtrs, hashes, live, pathCount);
+        TEST_ASSERT_LESS_OR_EQUAL(cache.getBudget(), cache.getUsedMemory());
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hash_is_fnv1a);
+    RUN_TEST(test_insert_and_find);
+    RUN_TEST(test_victim_is_largest_stalest);
+    RUN_TEST(test_pinned_entries_are_never_evicted);
+    RUN_TEST(test_removed_pinned_entry_lives_until_unpinned);
+    RUN_TEST(test_insert_rejected_when_rest_is_pinned);
+    RUN_TEST(test_insert_rejected_when_all_entries_pinned);
+    RUN_TEST(test_unlink_keeps_probe_chains);
+    RUN_TEST(test_random_churn_keeps_index);
+    return UNITY_END();
+}
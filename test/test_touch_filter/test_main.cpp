@@ -0,0 +1,145 @@
+#include <unity.h>
+#include "TouchFilter.h"
+
+#define PANEL_W     320
+#define PANEL_H     240
+#define SPREAD      48
+
+typedef struct {
+    int16_t rawX, rawY;
+    int16_t x, y;
+} cal_point_t;
+
+// Solves the six config values from three reference points (Cramer's rule),
+// the way a calibration screen would
+static void solveCalibration(const cal_point_t* p, float* cfg) {
+    float det = (float)p[0].rawX * (p[1].rawY - p[2].rawY) -
+                (float)p[1].rawX * (p[0].rawY - p[2].rawY) +
+                (float)p[2].rawX * (p[0].rawY - p[1].rawY);
+    for (int axis = 0; axis < 2; axis++) {
+        float t0 = axis ? p[0].y : p[0].x;
+        float t1 = axis ? p[1].y : p[1].x;
+        float t2 = axis ? p[2].y : p[2].x;
+        float* out = cfg + axis * 3;
+        out[0] = (t0 * (p[1].rawY - p[2].rawY) - t1 * (p[0].rawY - p[2].rawY) +
+                  t2 * (p[0].rawY - p[1].rawY)) / det;
+        out[1] = ((float)p[0].rawX * (t1 - t2) - (float)p[1].rawX * (t0 - t2) +
+                  (float)p[2].rawX * (t0 - t1)) / det;
+        out[2] = ((float)p[0].rawX * ((float)p[1].rawY * t2 - (float)p[2].rawY * t1) -
+                  (float)p[1].rawX * ((float)p[0].rawY * t2 - (float)p[2].rawY * t0) +
+                  (float)p[2].rawX * ((float)p[0].rawY * t1 - (float)p[1].rawY * t0)) / det;
+    }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_median_picks_middle(void) {
+    int16_t v[5] = {2010, 1995, 2003, 2000, 2008};
+    int16_t out = 0;
+    TEST_ASSERT_TRUE(touch_median(v, 5, SPREAD, &out));
+    TEST_ASSERT_EQUAL_INT16(2003, out);
+    for (int i = 1; i < 5; i++) {
+        TEST_ASSERT_LESS_OR_EQUAL(v[i], v[i - 1]);
+    }
+}
+
+void test_median_ignores_outliers(void) {
+    // A glitch at either end does not move the result
+    int16_t v[5] = {4095, 1500, 1510, 0, 1505};
+    int16_t out = 0;
+    TEST_ASSERT_TRUE(touch_median(v, 5, SPREAD, &out));
+    TEST_ASSERT_EQUAL_INT16(1505, out);
+}
+
+void test_median_spread_limit(void) {
+    int16_t ok[5] = {1000, 1000 + SPREAD, 1020, 900, 1100};
+    int16_t out = 0;
+    TEST_ASSERT_TRUE(touch_median(ok, 5, SPREAD, &out));
+    TEST_ASSERT_EQUAL_INT16(1020, out);
+
+    int16_t bad[5] = {1000, 1000 + SPREAD + 1, 1020, 900, 1100};
+    out = -1;
+    TEST_ASSERT_FALSE(touch_median(bad, 5, SPREAD, &out));
+    TEST_ASSERT_EQUAL_INT16(-1, out);
+}
+
+void test_identity_config_falls_back_to_nominal_range(void) {
+    const float identity[6] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    bsp_touch_cal_matrix_t m;
+    touch_load_calibration(identity, PANEL_W, PANEL_H, &m);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, m.b);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, m.d);
+
+    int16_t x, y;
+    touch_calibrate(m, 200, 240, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(1, x);
+    TEST_ASSERT_EQUAL_INT16(1, y);
+
+    touch_calibrate(m, 1950, 2020, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_INT_WITHIN(1, 160, x);
+    TEST_ASSERT_INT_WITHIN(1, 120, y);
+
+    // The ends of the nominal range land on the panel edge
+    touch_calibrate(m, 3700, 3800, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_EQUAL_INT16(PANEL_W - 1, x);
+    TEST_ASSERT_EQUAL_INT16(PANEL_H - 1, y);
+}
+
+void test_config_matrix_used_as_is(void) {
+    const float cfg[6] = {0.1f, 0.0f, -10.0f, 0.0f, 0.07f, -5.0f};
+    bsp_touch_cal_matrix_t m;
+    touch_load_calibration(cfg, PANEL_W, PANEL_H, &m);
+    TEST_ASSERT_EQUAL_MEMORY(cfg, &m, sizeof(cfg));
+}
+
+void test_three_point_calibration(void) {
+    // Panel mounted rotated: raw X follows screen Y and raw Y runs against
+    // screen X, with a little skew
+    const cal_point_t ref[3] = {
+        {3420, 3560, 20, 20},
+        {2180, 420, 300, 120},
+        {760, 1890, 160, 220},
+    };
+    float cfg[6];
+    solveCalibration(ref, cfg);
+
+    bsp_touch_cal_matrix_t m;
+    touch_load_calibration(cfg, PANEL_W, PANEL_H, &m);
+
+    int16_t x, y;
+    for (int i = 0; i < 3; i++) {
+        touch_calibrate(m, ref[i].rawX, ref[i].rawY, PANEL_W, PANEL_H, &x, &y);
+        TEST_ASSERT_EQUAL_INT16(ref[i].x, x);
+        TEST_ASSERT_EQUAL_INT16(ref[i].y, y);
+    }
+
+    // Affine, so the centroid of the raw points maps to the screen centroid
+    int16_t rx = (ref[0].rawX + ref[1].rawX + ref[2].rawX) / 3;
+    int16_t ry = (ref[0].rawY + ref[1].rawY + ref[2].rawY) / 3;
+    touch_calibrate(m, rx, ry, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_INT_WITHIN(1, (20 + 300 + 160) / 3, x);
+    TEST_ASSERT_INT_WITHIN(1, (20 + 120 + 220) / 3, y);
+
+    // Readings past the reference points clamp to the panel
+    touch_calibrate(m, 4095, 4095, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_TRUE(x >= 0 && x < PANEL_W);
+    TEST_ASSERT_TRUE(y >= 0 && y < PANEL_H);
+    touch_calibrate(m, 0, 0, PANEL_W, PANEL_H, &x, &y);
+    TEST_ASSERT_TRUE(x >= 0 && x < PANEL_W);
+    TEST_ASSERT_TRUE(y >= 0 && y < PANEL_H);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_median_picks_middle);
+    RUN_TEST(test_median_ignores_outliers);
+    RUN_TEST(test_median_spread_limit);
+    RUN_TEST(test_identity_config_falls_back_to_nominal_range);
+    RUN_TEST(test_config_matrix_used_as_is);
+    RUN_TEST(test_three_point_calibration);
+    return UNITY_END();
+}
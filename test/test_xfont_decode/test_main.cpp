@@ -0,0 +1,177 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "XFontDecode.h"
+
+// Relative to the project root, where pio test runs the program
+#define TEST_FONT_PATH  "data/x.font"
+#define MAX_SIZE        41      // largest size whose stream fits XFONT_GLYPH_BUF_SIZE
+#define MAX_OUT         ((MAX_SIZE * MAX_SIZE + 7) / 8)
+
+static const char* alphabet = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ@#";
+
+static int symbolValue(uint8_t c) {
+    const char* p = c ? strchr(alphabet, c) : nullptr;
+    return p ? (int)(p - alphabet) : -1;
+}
+
+// The per-pixel decoder XFontAdapter::unpackGlyph() used before the row
+// decoder, kept as the reference
+static void referenceDecode(const uint8_t* src, int srcLen, int size, int width, uint8_t* out) {
+    int bitIdx = 0;
+    for (int i = 0; i < srcLen; i++) {
+        int d = symbolValue(src[i]);
+        if (d < 0) continue;
+        for (int k = 5; k >= 0; k--) {
+            if ((d >> k) & 1) {
+                int x = bitIdx % size;
+                int y = bitIdx / size;
+                if (y < size && x < width) {
+                    int packedIdx = y * width + x;
+                    out[packedIdx / 8] |= (1 << (7 - (packedIdx % 8)));
+                }
+            }
+            bitIdx++;
+        }
+    }
+}
+
+// Same stride as XFontAdapter::loadLegacyHeader()
+static int fontPage(int size) {
+    return (size * size + 11) / 12 * 2;
+}
+
+// Mostly valid symbols with some bytes the decoder has to skip
+static void randomStream(uint8_t* buf, int len, int junkPercent) {
+    for (int i = 0; i < len; i++) {
+        if (rand() % 100 < junkPercent) {
+            buf[i] = rand() & 0xFF;
+        } else {
+            buf[i] = alphabet[rand() % 64];
+        }
+    }
+}
+
+static void assertSameDecode(const uint8_t* src, int srcLen, int size, int width) {
+    uint8_t expect[MAX_OUT + 1];
+    uint8_t actual[MAX_OUT + 1];
+    memset(expect, 0, sizeof(expect));
+    memset(actual, 0, sizeof(actual));
+    expect[MAX_OUT] = actual[MAX_OUT] = 0xA5;
+
+    referenceDecode(src, srcLen, size, width, expect);
+    xfont_s64_decode(src, srcLen, size, width, actual);
+
+    char msg[64];
+    snprintf(msg, sizeof(msg), "size %d width %d len %d", size, width, srcLen);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expect, actual, sizeof(expect), msg);
+}
+
+void setUp(void) {
+    srand(1234);
+}
+
+void tearDown(void) {
+}
+
+void test_random_streams_all_sizes(void) {
+    uint8_t src[2 * MAX_OUT * 2];
+    for (int size = 10; size <= MAX_SIZE; size++) {
+        int len = fontPage(size);
+        for (int round = 0; round < 50; round++) {
+            randomStream(src, len, 0);
+            assertSameDecode(src, len, size, size);
+            assertSameDecode(src, len, size, size / 2);
+            randomStream(src, len, 10);
+            assertSameDecode(src, len, size, size);
+            assertSameDecode(src, len, size, size / 2);
+        }
+    }
+}
+
+void test_short_and_long_streams(void) {
+    uint8_t src[2 * MAX_OUT * 2];
+    for (int size = 10; size <= MAX_SIZE; size++) {
+        int len = fontPage(size);
+        for (int round = 0; round < 20; round++) {
+            randomStream(src, len * 2, 5);
+            assertSameDecode(src, len / 2, size, size);
+            assertSameDecode(src, len / 2 + 1, size, size / 2);
+            assertSameDecode(src, len * 2, size, size);
+            assertSameDecode(src, 0, size, size);
+        }
+    }
+}
+
+void test_real_font_glyphs(void) {
+    FILE* f = fopen(TEST_FONT_PATH, "rb");
+    if (!f) {
+        TEST_IGNORE_MESSAGE("data/x.font not found");
+    }
+    fseek(f, 0, SEEK_END);
+    long fileSize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* data = (uint8_t*)malloc(fileSize);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(fileSize, (long)fread(data, 1, fileSize, f));
+    fclose(f);
+
+    char hex[7];
+    memcpy(hex, data, 6);
+    hex[6] = '\0';
+    int total = strtol(hex, NULL, 16);
+    int size = (data[6] - '0') * 10 + (data[7] - '0');
+    int page = fontPage(size);
+    long glyphs = 10 + (long)total * 5;
+    TEST_ASSERT_EQUAL(glyphs + (long)total * page, fileSize);
+
+    for (int i = 0; i < total; i++) {
+        const uint8_t* src = data + glyphs + (long)i * page;
+        assertSameDecode(src, page, size, size);
+        assertSameDecode(src, page, size, size / 2);
+    }
+    free(data);
+}
+
+void test_decode_speed(void) {
+    const int glyphs = 2048;
+    const int size = 24;
+    const int page = fontPage(size);
+    uint8_t* src = (uint8_t*)malloc(glyphs * page);
+    TEST_ASSERT_NOT_NULL(src);
+    randomStream(src, glyphs * page, 0);
+
+    uint8_t out[MAX_OUT];
+    unsigned sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < glyphs; i++) {
+        memset(out, 0, sizeof(out));
+        referenceDecode(src + i * page, page, size, size, out);
+        sink += out[i % sizeof(out)];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < glyphs; i++) {
+        memset(out, 0, sizeof(out));
+        xfont_s64_decode(src + i * page, page, size, size, out);
+        sink += out[i % sizeof(out)];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    free(src);
+
+    double refNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / glyphs;
+    double rowNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / glyphs;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "24px glyph: per-pixel %.0f ns, row decoder %.0f ns (%u)", refNs, rowNs, sink & 1);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_random_streams_all_sizes);
+    RUN_TEST(test_short_and_long_streams);
+    RUN_TEST(test_real_font_glyphs);
+    RUN_TEST(test_decode_speed);
+    return UNITY_END();
+}
@@ -0,0 +1,337 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+#include "XFontDecode.h"
+
+// Relative to the project root, where pio test runs the program
+#define LEGACY_PATH     "data/x.font"
+#define XFB_PATH        "data/x.xfb"    // tools/xfont_convert.py output, optional
+#define PARTITIONS_PATH "partitions.csv"
+#define TRACE_LEN       50000
+#define MAX_STRIDE      288     // XFONT_GLYPH_BUF_SIZE
+
+typedef struct {
+    uint8_t* data;
+    long size;
+} image_t;
+
+// Legacy font as XFontAdapter::loadLegacyHeader() sees it
+typedef struct {
+    image_t file;
+    int total;
+    int fontSize;
+    int fontPage;
+    long pixBegin;
+    uint16_t* codepoints;       // file order
+} legacy_font_t;
+
+// XFB image built in memory the way xfont_convert.py writes it (1bpp),
+// decoding each legacy page with xfont_s64_decode()
+typedef struct {
+    image_t file;
+    int glyphCount;
+    int stride;
+    uint32_t bitmapOffset;
+} xfb_font_t;
+
+static legacy_font_t legacy;
+static xfb_font_t xfb;
+
+static bool loadFile(const char* path, image_t* out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    out->size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    out->data = (uint8_t*)malloc(out->size);
+    bool ok = out->data && fread(out->data, 1, out->size, f) == (size_t)out->size;
+    fclose(f);
+    return ok;
+}
+
+static void put16(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static bool loadLegacy() {
+    if (!loadFile(LEGACY_PATH, &legacy.file)) return false;
+    const uint8_t* d = legacy.file.data;
+    char hex[7];
+    memcpy(hex, d, 6);
+    hex[6] = '\0';
+    legacy.total = strtol(hex, NULL, 16);
+    legacy.fontSize = (d[6] - '0') * 10 + (d[7] - '0');
+    legacy.fontPage = (legacy.fontSize * legacy.fontSize + 11) / 12 * 2;
+    legacy.pixBegin = 10 + (long)legacy.total * 5;
+    legacy.codepoints = (uint16_t*)malloc(legacy.total * sizeof(uint16_t));
+    for (int i = 0; i < legacy.total; i++) {
+        char cp[5];
+        memcpy(cp, d + 10 + i * 5 + 1, 4);
+        cp[4] = '\0';
+        legacy.codepoints[i] = strtol(cp, NULL, 16);
+    }
+    return true;
+}
+
+static int legacyWidth(uint16_t cp) {
+    return cp <= 0x7F ? legacy.fontSize / 2 : legacy.fontSize;
+}
+
+static int compareByCodepoint(const void* a, const void* b) {
+    int ia = *(const int*)a;
+    int ib = *(const int*)b;
+    return (int)legacy.codepoints[ia] - (int)legacy.codepoints[ib];
+}
+
+static void buildXfb() {
+    int count = legacy.total;
+    int size = legacy.fontSize;
+    xfb.glyphCount = count;
+    xfb.stride = (size * size + 7) / 8;
+    xfb.bitmapOffset = (XFB_HEADER_SIZE + count * 2 + 3) & ~3;
+    xfb.file.size = xfb.bitmapOffset + (long)count * xfb.stride;
+    xfb.file.data = (uint8_t*)calloc(1, xfb.file.size);
+
+    uint8_t* h = xfb.file.data;
+    memcpy(h, XFB_MAGIC, 4);
+    h[4] = XFB_VERSION;
+    h[5] = 1;                   // bpp
+    h[6] = size;
+    h[7] = size / 2;
+    put16(h + 8, count);
+    put16(h + 10, xfb.stride);
+    put32(h + 12, XFB_HEADER_SIZE);
+    put32(h + 16, xfb.bitmapOffset);
+
+    int* order = (int*)malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    qsort(order, count, sizeof(int), compareByCodepoint);
+    for (int k = 0; k < count; k++) {
+        int i = order[k];
+        put16(h + XFB_HEADER_SIZE + k * 2, legacy.codepoints[i]);
+        xfont_s64_decode(legacy.file.data + legacy.pixBegin + (long)i * legacy.fontPage, legacy.fontPage,
+                         size, legacyWidth(legacy.codepoints[i]),
+                         h + xfb.bitmapOffset + (long)k * xfb.stride);
+    }
+    free(order);
+}
+
+// Cache miss on a legacy font: read the s64 page, then decode it
+static void fetchLegacy(int i, uint8_t* out) {
+    uint8_t raw[512];
+    memcpy(raw, legacy.file.data + legacy.pixBegin + (long)i * legacy.fontPage, legacy.fontPage);
+    memset(out, 0, xfb.stride);
+    xfont_s64_decode(raw, legacy.fontPage, legacy.fontSize, legacyWidth(legacy.codepoints[i]), out);
+}
+
+// Cache miss on an XFB font: one read straight into the output
+static void fetchXfb(int k, uint8_t* out) {
+    memcpy(out, xfb.file.data + xfb.bitmapOffset + (long)k * xfb.stride, xfb.stride);
+}
+
+void setUp(void) {
+    if (!legacy.file.data) {
+        if (!loadLegacy()) {
+            TEST_IGNORE_MESSAGE("data/x.font not found");
+        }
+        buildXfb();
+    }
+}
+
+void tearDown(void) {
+}
+
+void test_converter_output(void) {
+    image_t converted;
+    if (!loadFile(XFB_PATH, &converted)) {
+        TEST_IGNORE_MESSAGE("data/x.xfb not found, run tools/xfont_convert.py data/x.font data/x.xfb");
+    }
+    if (converted.data[5] != 1) {
+        free(converted.data);
+        TEST_IGNORE_MESSAGE("data/x.xfb is not 1bpp");
+    }
+    TEST_ASSERT_EQUAL(xfb.file.size, converted.size);
+    TEST_ASSERT_EQUAL_MEMORY(xfb.file.data, converted.data, xfb.file.size);
+    free(converted.data);
+}
+
+void test_glyph_rate_by_format(void) {
+    // Misses over the whole font, as a cold chat screen would see them
+    int* trace = (int*)malloc(TRACE_LEN * sizeof(int));
+    srand(7);
+    for (int n = 0; n < TRACE_LEN; n++) {
+        trace[n] = rand() % legacy.total;
+    }
+
+    uint8_t out[512];
+    unsigned sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < TRACE_LEN; n++) {
+        fetchLegacy(trace[n], out);
+        sink += out[n % xfb.stride];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int n = 0; n < TRACE_LEN; n++) {
+        fetchXfb(trace[n], out);
+        sink += out[n % xfb.stride];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    free(trace);
+
+    double legacyRate = TRACE_LEN / std::chrono::duration<double>(t1 - t0).count();
+    double xfbRate = TRACE_LEN / std::chrono::duration<double>(t2 - t1).count();
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%dpx glyphs/s: x.font %.0f, XFB %.0f (%u)", legacy.fontSize, legacyRate, xfbRate,
+             sink & 1);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(xfbRate > legacyRate);
+}
+
+void test_header_check(void) {
+    xfb_header_t hdr;
+    memcpy(&hdr, xfb.file.data, sizeof(hdr));
+    TEST_ASSERT_TRUE(xfb_header_valid(&hdr, xfb.file.size, MAX_STRIDE));
+    TEST_ASSERT_TRUE(xfb_image_size(&hdr) == (uint64_t)xfb.file.size);
+
+    // Image cut short, e.g. a partition smaller than the file
+    TEST_ASSERT_FALSE(xfb_header_valid(&hdr, xfb.file.size - 1, MAX_STRIDE));
+    TEST_ASSERT_FALSE(xfb_header_valid(&hdr, xfb.bitmapOffset, MAX_STRIDE));
+    // Slots larger than the adapter's glyph buffer
+    TEST_ASSERT_FALSE(xfb_header_valid(&hdr, xfb.file.size, xfb.stride - 1));
+
+    xfb_header_t bad = hdr;
+    bad.bpp = 3;
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, xfb.file.size, MAX_STRIDE));
+    bad.bpp = 4;
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, xfb.file.size, MAX_STRIDE));
+    bad = hdr;
+    bad.version = 2;
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, xfb.file.size, MAX_STRIDE));
+    bad = hdr;
+    bad.glyphStride = xfb.stride - 1;
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, xfb.file.size, MAX_STRIDE));
+    bad = hdr;
+    bad.bitmapOffset = 0xFFFFFFF0u;
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, 0xFFFFFFFFu, MAX_STRIDE));
+
+    // A partition that was never flashed reads back as 0xFF
+    memset(&bad, 0xFF, sizeof(bad));
+    TEST_ASSERT_FALSE(xfb_header_valid(&bad, 0xFFFFFFFFu, MAX_STRIDE));
+}
+
+static uint32_t partitionSize(const char* name) {
+    FILE* f = fopen(PARTITIONS_PATH, "r");
+    if (!f) return 0;
+    char line[128];
+    char label[32];
+    unsigned offset = 0;
+    unsigned size = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, " %31[^, ] , %*[^,] , %*[^,] , %x , %x", label, &offset, &size) == 3 &&
+            strcmp(label, name) == 0) {
+            break;
+        }
+        size = 0;
+    }
+    fclose(f);
+    return size;
+}
+
+// The shipped font at every depth the adapter accepts has to fit the font
+// partition it is flashed to
+void test_depth_fits_partition(void) {
+    uint32_t part = partitionSize("font");
+    if (part == 0) {
+        TEST_IGNORE_MESSAGE(PARTITIONS_PATH " has no font partition");
+    }
+    xfb_header_t hdr;
+    memcpy(&hdr, xfb.file.data, sizeof(hdr));
+    char msg[96];
+    for (int bpp = 1; bpp <= XFB_MAX_BPP; bpp++) {
+        hdr.bpp = bpp;
+        hdr.glyphStride = (legacy.fontSize * legacy.fontSize * bpp + 7) / 8;
+        snprintf(msg, sizeof(msg), "%dbpp: %u B image, %u B partition", bpp,
+                 (unsigned)xfb_image_size(&hdr), (unsigned)part);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_TRUE(xfb_header_valid(&hdr, part, MAX_STRIDE));
+    }
+}
+
+// The partition backend on host: the same image mapped with POSIX mmap,
+// against a seek + read per glyph as the SPIFFS backend does
+void test_mapped_image_against_file_reads(void) {
+#ifdef _WIN32
+    TEST_IGNORE_MESSAGE("needs POSIX mmap");
+#else
+    FILE* f = tmpfile();
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL(xfb.file.size, (long)fwrite(xfb.file.data, 1, xfb.file.size, f));
+    fflush(f);
+    const uint8_t* map = (const uint8_t*)mmap(NULL, xfb.file.size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    TEST_ASSERT_TRUE(map != MAP_FAILED);
+
+    const xfb_header_t* hdr = (const xfb_header_t*)map;
+    TEST_ASSERT_TRUE(xfb_header_valid(hdr, xfb.file.size, MAX_STRIDE));
+
+    int* trace = (int*)malloc(TRACE_LEN * sizeof(int));
+    srand(11);
+    for (int n = 0; n < TRACE_LEN; n++) {
+        trace[n] = rand() % xfb.glyphCount;
+    }
+
+    uint8_t fromFile[MAX_STRIDE];
+    uint8_t fromMap[MAX_STRIDE];
+    for (int n = 0; n < 1000; n++) {
+        long offset = hdr->bitmapOffset + (long)trace[n] * hdr->glyphStride;
+        fseek(f, offset, SEEK_SET);
+        TEST_ASSERT_EQUAL(hdr->glyphStride, (int)fread(fromFile, 1, hdr->glyphStride, f));
+        TEST_ASSERT_EQUAL_MEMORY(fromFile, map + offset, hdr->glyphStride);
+    }
+
+    unsigned sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < TRACE_LEN; n++) {
+        fseek(f, hdr->bitmapOffset + (long)trace[n] * hdr->glyphStride, SEEK_SET);
+        sink += fread(fromFile, 1, hdr->glyphStride, f);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int n = 0; n < TRACE_LEN; n++) {
+        memcpy(fromMap, map + hdr->bitmapOffset + (long)trace[n] * hdr->glyphStride, hdr->glyphStride);
+        sink += fromMap[n % hdr->glyphStride];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "per glyph: seek+read %.0f ns, mapped copy %.0f ns (%u)",
+             std::chrono::duration<double, std::nano>(t1 - t0).count() / TRACE_LEN,
+             std::chrono::duration<double, std::nano>(t2 - t1).count() / TRACE_LEN, sink & 1);
+    TEST_MESSAGE(msg);
+
+    free(trace);
+    munmap((void*)map, xfb.file.size);
+    fclose(f);
+#endif
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_converter_output);
+    RUN_TEST(test_glyph_rate_by_format);
+    RUN_TEST(test_header_check);
+    RUN_TEST(test_depth_fits_partition);
+    RUN_TEST(test_mapped_image_against_file_reads);
+    return UNITY_END();
+}
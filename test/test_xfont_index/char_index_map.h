@@ -1,14 +1,13 @@
-// Auto-generated Unicode to charIndex mapping table
+// Unicode to charIndex table for data/x.font, as shipped in flash before
+// XFontIndex replaced it. Reference data for test_xfont_index only.
 // Total chars: 7543, Range: U+0000 to U+FFFF
-// Size: 131072 bytes (128 KB) in Flash
 
 #pragma once
 
-#include <Arduino.h>
+#include <stdint.h>
 
 // Map unicode to charIndex, -1 means not found
-// Usage: int16_t idx = pgm_read_word(&charIndexMap[unicode]);
-const int16_t charIndexMap[65536] PROGMEM = {
+static const int16_t charIndexMap[65536] = {
         -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  7448,  7447,    -1,    -1,  7446,    -1,    -1,  // U+0000 - U+000F
         -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  // U+0010 - U+001F
       7445,  7449,  7450,  7451,  7452,  7453,  7454,  7455,  7456,  7457,  7458,  7459,  7460,  7461,  7462,  7463,  // U+0020 - U+002F
@@ -0,0 +1,126 @@
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include "XFontIndex.h"
+#include "char_index_map.h"
+
+// x.font stores glyphs in file order, so the old table is the inverse of
+// its codepoint list
+static uint16_t fileOrder[65536];
+static int glyphCount;
+
+static void loadFileOrder() {
+    glyphCount = 0;
+    for (uint32_t cp = 0; cp < 0x10000; cp++) {
+        if (charIndexMap[cp] >= 0) {
+            fileOrder[charIndexMap[cp]] = cp;
+            glyphCount++;
+        }
+    }
+}
+
+// Same three passes as XFontAdapter::buildIndex()
+static bool buildIndex(XFontIndex& index, const uint16_t* cps, int count, bool withOrder) {
+    for (int i = 0; i < count; i++) {
+        index.reservePage(cps[i]);
+    }
+    if (!index.allocate()) {
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        index.add(cps[i]);
+    }
+    if (!index.finalize(count, withOrder)) {
+        return false;
+    }
+    if (withOrder) {
+        for (int i = 0; i < count; i++) {
+            index.setOrder(cps[i], i);
+        }
+    }
+    return true;
+}
+
+static int compareCodepoints(const void* a, const void* b) {
+    return (int)*(const uint16_t*)a - (int)*(const uint16_t*)b;
+}
+
+void setUp(void) {
+    loadFileOrder();
+}
+
+void tearDown(void) {
+}
+
+void test_legacy_order_matches_old_table(void) {
+    XFontIndex index;
+    TEST_ASSERT_TRUE(buildIndex(index, fileOrder, glyphCount, true));
+    TEST_ASSERT_EQUAL_INT(glyphCount, index.getCount());
+
+    for (uint32_t cp = 0; cp < 0x10000; cp++) {
+        TEST_ASSERT_EQUAL_INT(charIndexMap[cp], index.find(cp));
+    }
+
+    // Beyond the BMP nothing is found
+    TEST_ASSERT_EQUAL_INT(-1, index.find(0x10000));
+    TEST_ASSERT_EQUAL_INT(-1, index.find(0x1F600));
+
+    // Far below the 128 KB flat table
+    TEST_ASSERT_LESS_THAN(sizeof(charIndexMap) / 4, index.getMemoryUsage());
+}
+
+void test_sorted_order_finds_rank(void) {
+    static uint16_t sorted[65536];
+    memcpy(sorted, fileOrder, glyphCount * sizeof(uint16_t));
+    qsort(sorted, glyphCount, sizeof(uint16_t), compareCodepoints);
+
+    XFontIndex index;
+    TEST_ASSERT_TRUE(buildIndex(index, sorted, glyphCount, false));
+
+    for (int rank = 0; rank < glyphCount; rank++) {
+        TEST_ASSERT_EQUAL_INT(rank, index.find(sorted[rank]));
+    }
+    for (uint32_t cp = 0; cp < 0x10000; cp++) {
+        if (charIndexMap[cp] < 0) {
+            TEST_ASSERT_EQUAL_INT(-1, index.find(cp));
+        }
+    }
+}
+
+void test_duplicate_codepoints_rejected(void) {
+    const uint16_t cps[] = {0x41, 0x4E2D, 0x41, 0x6587};
+    XFontIndex index;
+    TEST_ASSERT_FALSE(buildIndex(index, cps, 4, true));
+}
+
+void test_empty_index(void) {
+    XFontIndex index;
+    TEST_ASSERT_FALSE(index.allocate());
+    TEST_ASSERT_EQUAL_INT(-1, index.find(0x41));
+    TEST_ASSERT_EQUAL_INT(0, index.getCount());
+}
+
+void test_clear_and_rebuild(void) {
+    const uint16_t first[] = {0x30, 0x31, 0x4E00};
+    const uint16_t second[] = {0x4E00, 0x30};
+    XFontIndex index;
+    TEST_ASSERT_TRUE(buildIndex(index, first, 3, true));
+    TEST_ASSERT_EQUAL_INT(2, index.find(0x4E00));
+
+    index.clear();
+    TEST_ASSERT_EQUAL_INT(-1, index.find(0x4E00));
+    TEST_ASSERT_TRUE(buildIndex(index, second, 2, true));
+    TEST_ASSERT_EQUAL_INT(0, index.find(0x4E00));
+    TEST_ASSERT_EQUAL_INT(1, index.find(0x30));
+    TEST_ASSERT_EQUAL_INT(-1, index.find(0x31));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_legacy_order_matches_old_table);
+    RUN_TEST(test_sorted_order_finds_rank);
+    RUN_TEST(test_duplicate_codepoints_rejected);
+    RUN_TEST(test_empty_index);
+    RUN_TEST(test_clear_and_rebuild);
+    return UNITY_END();
+}
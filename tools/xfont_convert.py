@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Convert the legacy s64 text font (x.font) into the XFB binary glyph atlas.
+
+x.font layout:
+    [0:6]   total glyph count, hex text
+    [6:8]   font size, decimal text
+    [8:10]  bin type, decimal text
+    [10:]   total * "uXXXX" codepoint index, then total * fontPage bytes of
+            s64 text (6 pixels per character, row-major, fontSize x fontSize)
+
+XFB layout (little-endian), see XFontAdapter.h:
+    header (XFB_HEADER_SIZE bytes)
+    uint16 codepoint[glyphCount]       sorted ascending
+    glyph[glyphCount][glyphStride]     packed rows, MSB first, no row padding
+
+Glyphs for codepoints <= 0x7F are trimmed to the half width, everything else
+is stored at full width. Each glyph occupies a fixed slot of glyphStride bytes
+so a lookup is a single read at bitmapOffset + index * glyphStride.
+
+Pixels are bpp bits each (1 or 2), the layout LVGL expects for
+lv_font_glyph_dsc_t.bpp. x.font itself is 1bpp, so anti-aliased output needs
+--ttf: every codepoint of x.font is rendered from that TrueType font (Pillow)
+at the same cell size and quantized. Glyphs the TTF cannot draw keep the
+x.font shape at full intensity. Without --ttf, --bpp 2 only widens the
+1bpp data.
+
+The image has to fit where it is flashed: the font partition (--target font,
+the default) or the SPIFFS image as /x.xfb (--target spiffs). Sizes come from
+partitions.csv; an image that does not fit is refused before anything is
+written. For the shipped 24px font 1bpp is ~545 KB and 2bpp ~1.05 MB; the
+1088 KB font partition holds either, SPIFFS (960 KB, mostly x.font) neither.
+4bpp (~2.1 MB) fits nowhere, so it is not offered.
+
+Usage:
+    python tools/xfont_convert.py data/x.font data/x.xfb
+    python tools/xfont_convert.py --bpp 2 --ttf NotoSansSC-Regular.otf data/x.font x.xfb
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+S64 = b"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ@#*$"
+S64_DECODE = {c: i for i, c in enumerate(S64)}
+
+XFB_MAGIC = b"XFB1"
+XFB_VERSION = 1
+XFB_HEADER_SIZE = 32
+# SPIFFS loses pages to metadata and keeps spare blocks for GC
+SPIFFS_USABLE_PCT = 85
+
+
+def read_legacy(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    total = int(data[0:6], 16)
+    font_size = int(data[6:8])
+    font_page = ((font_size * font_size + 11) // 12) * 2
+
+    index = data[10:10 + total * 5]
+    codepoints = []
+    for i in range(total):
+        entry = index[i * 5:i * 5 + 5]
+        if entry[:1] != b"u":
+            raise ValueError("bad index entry %d: %r" % (i, entry))
+        codepoints.append(int(entry[1:5], 16))
+
+    pix_begin = 10 + total * 5
+    glyphs = []
+    for i in range(total):
+        raw = data[pix_begin + i * font_page:pix_begin + (i + 1) * font_page]
+        bits = []
+        for c in raw:
+            v = S64_DECODE.get(c, 64)
+            if v < 64:
+                bits.extend((v >> k) & 1 for k in range(5, -1, -1))
+        bits = bits[:font_size * font_size]
+        bits.extend([0] * (font_size * font_size - len(bits)))
+        glyphs.append(bits)
+
+    return font_size, codepoints, glyphs
+
+
+def render_ttf(ttf_path, font_size, bpp, codepoints, glyphs):
+    """Replace glyphs with anti-aliased renderings, as levels 0..2^bpp-1."""
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit("--ttf needs Pillow (pip install pillow)")
+
+    font = ImageFont.truetype(ttf_path, font_size)
+    ascent, descent = font.getmetrics()
+    baseline = round(font_size * ascent / float(ascent + descent))
+    max_level = (1 << bpp) - 1
+    rendered = 0
+
+    out = []
+    for cp, bits in zip(codepoints, glyphs):
+        width = font_size // 2 if cp <= 0x7F else font_size
+        img = Image.new("L", (font_size, font_size), 0)
+        draw = ImageDraw.Draw(img)
+        x = (width - font.getlength(chr(cp))) / 2.0
+        draw.text((x, baseline), chr(cp), fill=255, font=font, anchor="ls")
+        px = list(img.getdata())
+
+        if not any(px) and any(bits):
+            out.append([b * max_level for b in bits])
+            continue
+        out.append([(v * max_level + 127) // 255 for v in px])
+        rendered += 1
+
+    print("rendered %d/%d glyphs from %s" % (rendered, len(codepoints), ttf_path))
+    return out
+
+
+def pack_glyph(levels, font_size, width, bpp, stride):
+    out = bytearray(stride)
+    idx = 0
+    for y in range(font_size):
+        for x in range(width):
+            v = levels[y * font_size + x]
+            if v:
+                shift = 8 - bpp - (idx & 7)
+                out[idx >> 3] |= v << shift
+            idx += bpp
+    return bytes(out)
+
+
+def xfb_layout(font_size, bpp, count):
+    """Return (stride, bitmap_offset, total size) of an XFB image."""
+    stride = (font_size * font_size * bpp + 7) // 8
+    bitmap_offset = (XFB_HEADER_SIZE + count * 2 + 3) & ~3
+    return stride, bitmap_offset, bitmap_offset + count * stride
+
+
+def target_size(target, dst):
+    """Bytes available to the image in the font partition, or in SPIFFS next
+    to the other files of data/."""
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    path = os.path.join(root, "partitions.csv")
+    with open(path) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#", 1)[0].split(",")]
+            if len(cols) >= 5 and cols[0] == target:
+                break
+        else:
+            sys.exit("no %s partition in %s" % (target, path))
+    size = int(cols[4], 0)
+    if target == "spiffs":
+        size = size * SPIFFS_USABLE_PCT // 100
+        data = os.path.join(root, "data")
+        for name in os.listdir(data):
+            if name != os.path.basename(dst):
+                size -= os.path.getsize(os.path.join(data, name))
+    return max(size, 0)
+
+
+def write_xfb(path, font_size, bpp, codepoints, glyphs):
+    half_width = font_size // 2
+    count = len(codepoints)
+    stride, bitmap_offset, size = xfb_layout(font_size, bpp, count)
+
+    order = sorted(range(count), key=lambda i: codepoints[i])
+    cp_offset = XFB_HEADER_SIZE
+
+    header = struct.pack(
+        "<4sBBBBHHIII",
+        XFB_MAGIC, XFB_VERSION, bpp, font_size, half_width,
+        count, stride, cp_offset, bitmap_offset, 0)
+    header = header.ljust(XFB_HEADER_SIZE, b"\0")
+
+    with open(path, "wb") as f:
+        f.write(header)
+        for i in order:
+            f.write(struct.pack("<H", codepoints[i]))
+        f.write(b"\0" * (bitmap_offset - (cp_offset + count * 2)))
+        for i in order:
+            width = half_width if codepoints[i] <= 0x7F else font_size
+            f.write(pack_glyph(glyphs[i], font_size, width, bpp, stride))
+
+    return size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("src", help="legacy x.font")
+    parser.add_argument("dst", help="output .xfb")
+    parser.add_argument("--bpp", type=int, choices=(1, 2), default=1,
+                        help="bits per pixel (default 1)")
+    parser.add_argument("--target", choices=("font", "spiffs"), default="font",
+                        help="where the image is flashed (default font partition)")
+    parser.add_argument("--ttf", help="TrueType font to render anti-aliased glyphs from")
+    args = parser.parse_args()
+
+    font_size, codepoints, glyphs = read_legacy(args.src)
+    if len(set(codepoints)) != len(codepoints):
+        sys.exit("duplicate codepoints in %s" % args.src)
+    if any(cp > 0xFFFF for cp in codepoints):
+        sys.exit("codepoints above U+FFFF are not supported")
+
+    size = xfb_layout(font_size, args.bpp, len(codepoints))[2]
+    room = target_size(args.target, args.dst)
+    if size > room:
+        sys.exit("%dbpp image is %d bytes, %s has room for %d" % (args.bpp, size, args.target, room))
+
+    if args.ttf:
+        glyphs = render_ttf(args.ttf, font_size, args.bpp, codepoints, glyphs)
+    elif args.bpp > 1:
+        max_level = (1 << args.bpp) - 1
+        glyphs = [[b * max_level for b in bits] for bits in glyphs]
+
+    size = write_xfb(args.dst, font_size, args.bpp, codepoints, glyphs)
+    print("%s: %d glyphs, %dpx, %dbpp, %d bytes" % (args.dst, len(codepoints), font_size,
+                                                  args.bpp, size))
+
+
+if __name__ == "__main__":
+    main()
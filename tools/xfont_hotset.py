@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Build the flash-resident "hot" glyph subset (src/xfont_hot.h).
+
+Glyphs in the hot subset are compiled into the firmware as PROGMEM and are
+served by XFontAdapter without touching the filesystem or the RAM cache.
+
+The subset is, in order:
+    1. printable ASCII
+    2. every non-ASCII character in string literals under --seed-src
+       (UI labels, so they paint instantly)
+    3. the most used glyphs from one or more usage logs, recorded on device
+       with system.glyphProfile = true (SD:/glyph_usage.txt, "hhhh count"
+       per line), until --top glyphs are selected
+
+Pixels come from x.font, optionally re-rendered with --bpp/--ttf exactly like
+xfont_convert.py. The hot set is only used when its size and bpp match the
+font loaded on the device, so regenerate it together with x.xfb.
+
+Usage:
+    python tools/xfont_hotset.py data/x.font src/xfont_hot.h --seed-src src
+    python tools/xfont_hotset.py data/x.font src/xfont_hot.h --seed-src src \\
+        --usage glyph_usage.txt --top 500
+"""
+
+import argparse
+import glob
+import os
+import re
+
+import xfont_convert
+
+
+def read_usage(paths):
+    counts = {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                parts = line.split()
+                if len(parts) != 2:
+                    continue
+                cp = int(parts[0], 16)
+                counts[cp] = counts.get(cp, 0) + int(parts[1])
+    return counts
+
+
+def read_seed_chars(src_dir):
+    chars = []
+    literal = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+    files = sorted(glob.glob(os.path.join(src_dir, "*.cpp")) +
+                   glob.glob(os.path.join(src_dir, "*.h")))
+    for path in files:
+        with open(path, encoding="utf-8", errors="ignore") as f:
+            text = f.read()
+        text = re.sub(r"//[^\n]*", "", text)
+        text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+        for m in literal.finditer(text):
+            chars.extend(ord(c) for c in m.group(1) if 0x7F < ord(c) <= 0xFFFF)
+    return chars
+
+
+def write_header(path, font_size, bpp, stride, selected):
+    count = len(selected)
+    lines = [
+        "// Auto-generated by tools/xfont_hotset.py - do not edit",
+        "// Hot glyph subset served from flash before the font file is touched",
+        "",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define XFONT_HOT_COUNT  %d" % count,
+        "#define XFONT_HOT_SIZE   %d" % font_size,
+        "#define XFONT_HOT_BPP    %d" % bpp,
+        "#define XFONT_HOT_STRIDE %d" % stride,
+        "",
+        "// Sorted ascending for binary search",
+        "const uint16_t xfontHotCodepoints[%s] PROGMEM = {" %
+        ("XFONT_HOT_COUNT" if count else "1"),
+    ]
+    cps = [cp for cp, _ in selected] or [0]
+    for i in range(0, len(cps), 12):
+        lines.append("    " + ", ".join("0x%04x" % cp for cp in cps[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("const uint8_t xfontHotBitmaps[%s] PROGMEM = {" %
+                 ("XFONT_HOT_COUNT * XFONT_HOT_STRIDE" if count else "1"))
+    for cp, data in selected:
+        lines.append("    // U+%04X" % cp)
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    if not count:
+        lines.append("    0,")
+    lines.append("};")
+    lines.append("")
+
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("src", help="legacy x.font")
+    parser.add_argument("dst", help="output header, normally src/xfont_hot.h")
+    parser.add_argument("--usage", nargs="*", default=[], help="glyph usage logs from SD")
+    parser.add_argument("--seed-src", help="source directory scanned for UI string literals")
+    parser.add_argument("--top", type=int, default=500, help="maximum glyphs in the subset")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1)
+    parser.add_argument("--ttf", help="TrueType font, as for xfont_convert.py")
+    args = parser.parse_args()
+
+    font_size, codepoints, glyphs = xfont_convert.read_legacy(args.src)
+    if args.ttf:
+        glyphs = xfont_convert.render_ttf(args.ttf, font_size, args.bpp, codepoints, glyphs)
+    elif args.bpp > 1:
+        max_level = (1 << args.bpp) - 1
+        glyphs = [[b * max_level for b in bits] for bits in glyphs]
+    by_cp = dict(zip(codepoints, glyphs))
+
+    wanted = list(range(0x20, 0x7F))
+    if args.seed_src:
+        wanted += read_seed_chars(args.seed_src)
+    usage = read_usage(args.usage)
+    wanted += sorted(usage, key=lambda cp: -usage[cp])
+
+    chosen = []
+    seen = set()
+    for cp in wanted:
+        if cp in seen or cp not in by_cp:
+            continue
+        seen.add(cp)
+        chosen.append(cp)
+        if len(chosen) >= args.top:
+            break
+
+    stride = (font_size * font_size * args.bpp + 7) // 8
+    half_width = font_size // 2
+    selected = []
+    for cp in sorted(chosen):
+        width = half_width if cp <= 0x7F else font_size
+        selected.append((cp, xfont_convert.pack_glyph(by_cp[cp], font_size, width,
+                                                      args.bpp, stride)))
+
+    write_header(args.dst, font_size, args.bpp, stride, selected)
+    print("%s: %d glyphs, %dpx, %dbpp, %d bytes of flash" % (
+        args.dst, len(selected), font_size, args.bpp, len(selected) * (stride + 2)))
+
+
+if __name__ == "__main__":
+    main()